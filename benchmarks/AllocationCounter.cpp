@@ -0,0 +1,44 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic_size_t allocations{0u};
+}
+
+std::size_t gimo::benchmarks::allocation_count() noexcept
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+// Replaces the global allocation functions for the whole benchmark executable.
+// The additional relaxed increment is negligible compared to the allocation itself.
+void* operator new(std::size_t const size)
+{
+    allocations.fetch_add(1u, std::memory_order_relaxed);
+    if (void* const memory = std::malloc(0u == size ? 1u : size))
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* const memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* const memory, [[maybe_unused]] std::size_t const size) noexcept
+{
+    std::free(memory);
+}
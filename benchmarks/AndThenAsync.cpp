@@ -0,0 +1,106 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/Task.hpp"
+#include "gimo/ThreadPool.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/AndThenAsync.hpp"
+#include "gimo/algorithm/Transform.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+ * Each input is looked up on a simulated local disk, which blocks the calling thread for a fixed latency.
+ * The blocking pipeline performs the lookups one after another, while the asynchronous one overlaps them on a thread-pool.
+ */
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    using Input = std::optional<int>;
+
+    constexpr std::chrono::microseconds diskLatency{50};
+    constexpr std::size_t requestCount{256u};
+    constexpr std::size_t workerCount{8u};
+
+    [[nodiscard]]
+    std::optional<int> read_from_disk(int const key)
+    {
+        std::this_thread::sleep_for(diskLatency);
+        if (key % 97 == 0)
+        {
+            return std::nullopt;
+        }
+
+        return key + 1;
+    }
+
+    [[nodiscard]]
+    gimo::Task<std::optional<int>> read_from_disk_async(gimo::ThreadPool& pool, int const key)
+    {
+        co_await pool.schedule();
+
+        co_return read_from_disk(key);
+    }
+
+    constexpr auto increment = gimo::transform([](int const value) noexcept { return value + 1; });
+}
+
+void gimo::benchmarks::and_then_async_suite()
+{
+    auto bench = make_bench("and_then_async");
+    bench.warmup(1u)
+        .epochs(5u);
+
+    ThreadPool pool{workerCount};
+    auto const blocking = increment
+                        | gimo::and_then(&read_from_disk)
+                        | increment;
+    auto const async = increment
+                     | gimo::and_then_async([&](int const key) { return read_from_disk_async(pool, key); })
+                     | increment;
+
+    std::string const suffix = " - " + std::to_string(diskLatency.count()) + "us latency - "
+                             + std::to_string(workerCount) + " worker(s)";
+    for (double const nullProbability : nullProbabilities)
+    {
+        auto const inputs = make_inputs<OptionalKind, int>(nullProbability, requestCount);
+        std::string const description = describe(OptionalKind::name, type_name<int>(), 3u, nullProbability) + suffix;
+
+        bench.batch(inputs.size())
+            .run(
+                "gimo::and_then (blocking)" + description,
+                [&] {
+                    for (Input const& input : inputs)
+                    {
+                        ankerl::nanobench::doNotOptimizeAway(blocking.apply(input));
+                    }
+                });
+
+        bench.batch(inputs.size())
+            .run(
+                "gimo::and_then_async" + description,
+                [&] {
+                    std::vector<Task<Input>> tasks{};
+                    tasks.reserve(inputs.size());
+                    for (Input const& input : inputs)
+                    {
+                        tasks.emplace_back(async.apply(input));
+                    }
+
+                    ankerl::nanobench::doNotOptimizeAway(gimo::sync_wait_all(std::move(tasks)));
+                });
+    }
+
+    report(bench, "and_then_async");
+}
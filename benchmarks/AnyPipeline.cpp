@@ -0,0 +1,80 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/AnyPipeline.hpp"
+#include "gimo/algorithm/Transform.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    using Input = std::optional<int>;
+    using AnyChain = gimo::AnyPipeline<Input const&, Input>;
+    using StepFunction = std::function<Input(Input const&)>;
+
+    constexpr auto step = gimo::transform(Increment{});
+
+    template <std::size_t length>
+    void run_chain(ankerl::nanobench::Bench& bench, double const nullProbability)
+    {
+        static constexpr auto pipeline = repeat(step, std::make_index_sequence<length>{});
+
+        // Each step is erased on its own; thus each step costs an indirect call.
+        std::vector<StepFunction> functions(length, [](Input const& input) { return step.apply(input); });
+        AnyChain const any{pipeline};
+
+        auto const inputs = make_inputs<OptionalKind, int>(nullProbability);
+        run_over(
+            bench,
+            "Pipeline::apply" + describe(OptionalKind::name, type_name<int>(), length, nullProbability),
+            inputs,
+            [](Input const& input) { return pipeline.apply(input); });
+        run_over(
+            bench,
+            "gimo::AnyPipeline" + describe(OptionalKind::name, type_name<int>(), length, nullProbability),
+            inputs,
+            [&](Input const& input) { return any.apply(input); });
+        run_over(
+            bench,
+            "std::function chain" + describe(OptionalKind::name, type_name<int>(), length, nullProbability),
+            inputs,
+            [&](Input const& input) {
+                Input result{input};
+                for (StepFunction const& function : functions)
+                {
+                    result = function(result);
+                }
+
+                return result;
+            });
+    }
+}
+
+void gimo::benchmarks::any_pipeline_suite()
+{
+    auto bench = make_bench("any pipeline");
+
+    std::cout << "gimo::AnyPipeline - " << sizeof(AnyChain) << " bytes; "
+              << "std::function chain - " << sizeof(StepFunction) << " bytes per step.\n";
+
+    for_each_length(chain_lengths{}, [&]<std::size_t length>([[maybe_unused]] std::integral_constant<std::size_t, length> const) {
+        for (double const nullProbability : nullProbabilities)
+        {
+            run_chain<length>(bench, nullProbability);
+        }
+    });
+
+    report(bench, "any_pipeline");
+}
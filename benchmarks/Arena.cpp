@@ -0,0 +1,133 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo/algorithm/ValueOrElse.hpp"
+#include "gimo_ext/Arena.hpp"
+#include "gimo_ext/StdUniquePtr.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    constexpr std::size_t elementCount{1'000'000u};
+
+    // The temporaries of each request are released at once.
+    constexpr std::size_t requestSize{1'024u};
+
+    struct UniquePtrFactory
+    {
+        static constexpr std::string_view name{"std::unique_ptr"};
+
+        template <typename T>
+        using pointer = std::unique_ptr<T>;
+
+        template <typename T, typename... Args>
+        [[nodiscard]]
+        static pointer<T> make(Args&&... args)
+        {
+            return std::make_unique<T>(std::forward<Args>(args)...);
+        }
+
+        static void reset() noexcept
+        {
+        }
+    };
+
+    template <typename Arena>
+    struct ArenaFactory
+    {
+        static constexpr std::string_view name{
+            std::same_as<gimo::MonotonicArena, Arena>
+                ? "gimo::ArenaHandle<T, MonotonicArena>"
+                : "gimo::ArenaHandle<T, PoolArena>"};
+
+        template <typename T>
+        using pointer = gimo::ArenaHandle<T, Arena>;
+
+        template <typename T, typename... Args>
+        [[nodiscard]]
+        static pointer<T> make(Args&&... args)
+        {
+            return gimo::make_arena_handle<T>(gimo::current_arena<Arena>(), std::forward<Args>(args)...);
+        }
+
+        static void reset() noexcept
+        {
+            gimo::current_arena<Arena>().reset();
+        }
+    };
+
+    template <typename Factory>
+    constexpr auto steps = gimo::transform([](int const value) { return make_value<Large>(static_cast<std::size_t>(value)); })
+                         | gimo::transform([](Large large) {
+                               large.bytes[1] = large.bytes[0] + 1u;
+                               return large;
+                           })
+                         | gimo::and_then([](Large const& large) {
+                               auto ptr = Factory::template make<double>(large.bytes[1]);
+                               // Prevents the compiler from eliding the allocation.
+                               ankerl::nanobench::doNotOptimizeAway(ptr.get());
+                               return ptr;
+                           })
+                         | gimo::value_or(0.0);
+
+    template <typename Factory>
+    void run(ankerl::nanobench::Bench& bench, std::vector<bool> const& mask)
+    {
+        std::size_t const before = allocation_count();
+        auto const process = [&] {
+            double sum{};
+            for (std::size_t request{0u}; request < elementCount; request += requestSize)
+            {
+                for (std::size_t i{request}; i < request + requestSize && i < elementCount; ++i)
+                {
+                    auto source = mask[i]
+                                    ? typename Factory::template pointer<int>{}
+                                    : Factory::template make<int>(static_cast<int>(i));
+                    ankerl::nanobench::doNotOptimizeAway(source.get());
+                    sum += gimo::apply(std::move(source), steps<Factory>);
+                }
+
+                Factory::reset();
+            }
+
+            return sum;
+        };
+
+        ankerl::nanobench::doNotOptimizeAway(process());
+        std::cout << Factory::name << " - global allocations per " << elementCount << " elements: "
+                  << allocation_count() - before << ".\n";
+
+        bench.batch(elementCount)
+            .run(
+                std::string{Factory::name},
+                [&] { ankerl::nanobench::doNotOptimizeAway(process()); });
+    }
+}
+
+void gimo::benchmarks::arena_suite()
+{
+    auto bench = make_bench("arena");
+
+    std::vector<bool> const mask = make_null_mask(elementCount, 0.1, NullDistribution::uniform);
+    run<ArenaFactory<MonotonicArena>>(bench, mask);
+    run<ArenaFactory<PoolArena>>(bench, mask);
+    run<UniquePtrFactory>(bench, mask);
+
+    report(bench, "arena");
+}
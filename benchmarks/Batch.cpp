@@ -0,0 +1,99 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/Batch.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    constexpr std::size_t batchSize{1u << 16u};
+
+    struct Halve
+    {
+        [[nodiscard]]
+        constexpr std::optional<int> operator()(int const value) const noexcept
+        {
+            if (value % 2 != 0)
+            {
+                return std::nullopt;
+            }
+
+            return value / 2;
+        }
+    };
+
+    void run(ankerl::nanobench::Bench& bench, double const nullProbability)
+    {
+        static constexpr auto pipeline = gimo::transform(Increment{})
+                                       | gimo::and_then(Halve{})
+                                       | gimo::transform(Increment{});
+
+        auto const inputs = make_inputs<OptionalKind, int>(nullProbability, batchSize);
+        std::vector<std::optional<int>> outputs(inputs.size());
+        std::string const suffix = describe(OptionalKind::name, type_name<int>(), 3u, nullProbability);
+
+        bench.batch(inputs.size())
+            .run(
+                "handwritten loop" + suffix,
+                [&] {
+                    for (std::size_t i{0u}; i < inputs.size(); ++i)
+                    {
+                        std::optional<int> result{};
+                        if (inputs[i])
+                        {
+                            if (int const value = *inputs[i] + 1;
+                                value % 2 == 0)
+                            {
+                                result = value / 2 + 1;
+                            }
+                        }
+
+                        outputs[i] = result;
+                    }
+                    ankerl::nanobench::doNotOptimizeAway(outputs.data());
+                });
+
+        bench.batch(inputs.size())
+            .run(
+                "gimo::apply loop" + suffix,
+                [&] {
+                    for (std::size_t i{0u}; i < inputs.size(); ++i)
+                    {
+                        outputs[i] = gimo::apply(inputs[i], pipeline);
+                    }
+                    ankerl::nanobench::doNotOptimizeAway(outputs.data());
+                });
+
+        bench.batch(inputs.size())
+            .run(
+                "gimo::apply_each" + suffix,
+                [&] {
+                    gimo::apply_each(inputs, pipeline, outputs.begin());
+                    ankerl::nanobench::doNotOptimizeAway(outputs.data());
+                });
+    }
+}
+
+void gimo::benchmarks::batch_suite()
+{
+    auto bench = make_bench("batch");
+
+    for (double const nullProbability : nullProbabilities)
+    {
+        run(bench, nullProbability);
+    }
+
+    report(bench, "batch");
+}
@@ -0,0 +1,131 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/Batch.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo/algorithm/ValueOrElse.hpp"
+#include "gimo_ext/BitmapColumn.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    constexpr std::size_t columnSize{1u << 16u};
+
+    struct Halve
+    {
+        [[nodiscard]]
+        constexpr std::optional<int> operator()(int const value) const noexcept
+        {
+            if (value % 2 != 0)
+            {
+                return std::nullopt;
+            }
+
+            return value / 2;
+        }
+    };
+
+    [[nodiscard]]
+    gimo::BitmapColumn<int> to_column(std::vector<std::optional<int>> const& inputs)
+    {
+        gimo::BitmapColumn<int> column(inputs.size());
+        for (std::size_t i{0u}; i < inputs.size(); ++i)
+        {
+            if (inputs[i])
+            {
+                column.set(i, *inputs[i]);
+            }
+        }
+
+        return column;
+    }
+
+    void print_footprint()
+    {
+        constexpr double aos = sizeof(std::optional<int>);
+        constexpr double soa = sizeof(int) + 1.0 / 8.0;
+        std::cout << "Memory footprint per element: "
+                  << "std::vector<std::optional<int>> " << aos << " bytes; "
+                  << "gimo::BitmapColumn<int> " << soa << " bytes.\n";
+    }
+
+    template <typename Pipeline>
+    void run(
+        ankerl::nanobench::Bench& bench,
+        std::string const& name,
+        Pipeline const& pipeline,
+        NullDistribution const distribution,
+        double const nullRatio)
+    {
+        std::vector<bool> const mask = make_null_mask(columnSize, nullRatio, distribution);
+        std::vector<std::optional<int>> inputs(columnSize);
+        for (std::size_t i{0u}; i < columnSize; ++i)
+        {
+            if (!mask[i])
+            {
+                inputs[i] = static_cast<int>(i);
+            }
+        }
+        gimo::BitmapColumn<int> const column = to_column(inputs);
+
+        using Result = decltype(pipeline.apply(inputs.front()));
+        std::vector<Result> outputs(columnSize);
+
+        std::string suffix{" - "};
+        suffix += name;
+        suffix += " - ";
+        suffix += std::to_string(static_cast<int>(nullRatio * 100.0));
+        suffix += "% null - ";
+        suffix += distribution_name(distribution);
+
+        bench.batch(columnSize)
+            .run(
+                "AoS gimo::apply_each" + suffix,
+                [&] {
+                    gimo::apply_each(inputs, pipeline, outputs.begin());
+                    ankerl::nanobench::doNotOptimizeAway(outputs.data());
+                });
+
+        bench.batch(columnSize)
+            .run(
+                "SoA gimo::apply_each" + suffix,
+                [&] {
+                    auto result = gimo::apply_each(column, pipeline);
+                    ankerl::nanobench::doNotOptimizeAway(result);
+                });
+    }
+}
+
+void gimo::benchmarks::bitmap_column_suite()
+{
+    static constexpr auto propagating = gimo::transform(Increment{})
+                                      | gimo::and_then(Halve{});
+    static constexpr auto handling = gimo::transform(Increment{})
+                                   | gimo::value_or(-1);
+
+    print_footprint();
+    auto bench = make_bench("bitmap column");
+
+    for (NullDistribution const distribution : {NullDistribution::uniform, NullDistribution::clustered})
+    {
+        for (double const nullRatio : {0.0, 0.1, 0.5, 0.9})
+        {
+            run(bench, "transform | and_then", propagating, distribution, nullRatio);
+            run(bench, "transform | value_or", handling, distribution, nullRatio);
+        }
+    }
+
+    report(bench, "bitmap_column");
+}
@@ -0,0 +1,421 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_BENCHMARKS_COMMONS_HPP
+#define GIMO_BENCHMARKS_COMMONS_HPP
+
+#pragma once
+
+#include "gimo/Pipeline.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include <version>
+#ifdef __cpp_lib_expected
+    #include "gimo_ext/StdExpected.hpp"
+#endif
+
+#include <nanobench.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gimo::benchmarks
+{
+    /**
+     * \brief A trivially copyable value-type, which is too large to be passed via registers.
+     */
+    struct Large
+    {
+        std::array<std::uint8_t, 256u> bytes{};
+    };
+
+    template <typename T>
+    [[nodiscard]]
+    T make_value(std::size_t const index)
+    {
+        if constexpr (std::same_as<int, T>)
+        {
+            return static_cast<int>(index);
+        }
+        else if constexpr (std::same_as<std::string, T>)
+        {
+            // Exceeds the small-string-buffer on purpose.
+            return std::string(32u, 'x') + std::to_string(index);
+        }
+        else
+        {
+            static_assert(std::same_as<Large, T>);
+            Large large{};
+            large.bytes.front() = static_cast<std::uint8_t>(index);
+
+            return large;
+        }
+    }
+
+    template <typename T>
+    [[nodiscard]]
+    constexpr std::string_view type_name() noexcept
+    {
+        if constexpr (std::same_as<int, T>)
+        {
+            return "int";
+        }
+        else if constexpr (std::same_as<std::string, T>)
+        {
+            return "std::string";
+        }
+        else
+        {
+            static_assert(std::same_as<Large, T>);
+            return "Large(256B)";
+        }
+    }
+
+    /**
+     * \brief The common value-to-value operation, which is used by all chains.
+     */
+    struct Increment
+    {
+        [[nodiscard]]
+        constexpr int operator()(int const value) const noexcept
+        {
+            return value + 1;
+        }
+
+        [[nodiscard]]
+        std::string operator()(std::string const& str) const
+        {
+            return str + '.';
+        }
+
+        [[nodiscard]]
+        constexpr Large operator()(Large large) const noexcept
+        {
+            ++large.bytes.front();
+            return large;
+        }
+    };
+
+    struct OptionalKind
+    {
+        template <typename T>
+        using type = std::optional<T>;
+
+        static constexpr std::string_view name{"std::optional"};
+
+        template <typename T>
+        [[nodiscard]]
+        static type<T> make_null()
+        {
+            return std::nullopt;
+        }
+    };
+
+#ifdef __cpp_lib_expected
+    struct ExpectedKind
+    {
+        template <typename T>
+        using type = std::expected<T, int>;
+
+        static constexpr std::string_view name{"std::expected"};
+
+        template <typename T>
+        [[nodiscard]]
+        static type<T> make_null()
+        {
+            return std::unexpected{-1};
+        }
+    };
+
+    using nullable_kinds = std::tuple<OptionalKind, ExpectedKind>;
+#else
+    using nullable_kinds = std::tuple<OptionalKind>;
+#endif
+
+    using value_types = std::tuple<int, std::string, Large>;
+    using chain_lengths = std::index_sequence<1u, 3u, 8u>;
+    inline constexpr std::array nullProbabilities{0.0, 0.5, 1.0};
+    inline constexpr std::size_t inputCount{1024u};
+
+    /**
+     * \brief Determines, whether the nullable provides the C++23 monadic member-functions.
+     * \details Not every standard-library ships them for `std::expected` yet.
+     */
+    template <typename Nullable>
+    concept has_monadic_members = requires(Nullable const& nullable) {
+        nullable.transform(Increment{});
+    };
+
+    template <typename TypeList, typename Fun>
+    void for_each_type(Fun&& fun)
+    {
+        [&]<typename... Ts>([[maybe_unused]] std::type_identity<std::tuple<Ts...>> const tag) {
+            (fun(std::type_identity<Ts>{}), ...);
+        }(std::type_identity<TypeList>{});
+    }
+
+    template <typename Fun, std::size_t... lengths>
+    void for_each_length([[maybe_unused]] std::index_sequence<lengths...> const tag, Fun&& fun)
+    {
+        (fun(std::integral_constant<std::size_t, lengths>{}), ...);
+    }
+
+    /**
+     * \brief Generates the inputs of a single benchmark run, where each element is null with the given probability.
+     */
+    template <typename Kind, typename T>
+    [[nodiscard]]
+    std::vector<typename Kind::template type<T>> make_inputs(double const nullProbability, std::size_t const count = inputCount)
+    {
+        ankerl::nanobench::Rng rng{1337u};
+        std::vector<typename Kind::template type<T>> inputs{};
+        inputs.reserve(count);
+        for (std::size_t i{0u}; i < count; ++i)
+        {
+            if (rng.uniform01() < nullProbability)
+            {
+                inputs.emplace_back(Kind::template make_null<T>());
+            }
+            else
+            {
+                inputs.emplace_back(make_value<T>(i));
+            }
+        }
+
+        return inputs;
+    }
+
+    /**
+     * \brief Determines, how the null elements are spread over the generated inputs.
+     */
+    enum class NullDistribution
+    {
+        /**
+         * \brief Each element is null independently of its neighbours.
+         */
+        uniform,
+
+        /**
+         * \brief Null elements appear in runs, as they would be caused by a temporarily failing upstream.
+         */
+        clustered,
+
+        /**
+         * \brief The null-ratio itself is random and changes from block to block; the requested ratio is ignored.
+         */
+        random
+    };
+
+    [[nodiscard]]
+    constexpr std::string_view distribution_name(NullDistribution const distribution) noexcept
+    {
+        switch (distribution)
+        {
+        case NullDistribution::uniform:   return "uniform";
+        case NullDistribution::clustered: return "clustered";
+        case NullDistribution::random:    return "random";
+        }
+
+        return "unknown";
+    }
+
+    /**
+     * \brief Generates a mask, where each `true` denotes a null element.
+     * \details
+     * For `clustered` distributions, runs of nulls and values alternate with geometrically distributed lengths,
+     * so that the overall ratio is preserved.
+     * For `random` distributions, the ratio of each block of 64 elements is drawn from `[0, 1)`.
+     */
+    [[nodiscard]]
+    inline std::vector<bool> make_null_mask(
+        std::size_t const count,
+        double const nullRatio,
+        NullDistribution const distribution,
+        std::uint64_t const seed = 1337u)
+    {
+        ankerl::nanobench::Rng rng{seed};
+        std::vector<bool> mask(count, false);
+
+        switch (distribution)
+        {
+        case NullDistribution::uniform:
+            for (std::size_t i{0u}; i < count; ++i)
+            {
+                mask[i] = rng.uniform01() < nullRatio;
+            }
+            break;
+
+        case NullDistribution::clustered:
+        {
+            constexpr double meanRunLength{64.0};
+            bool isNull = rng.uniform01() < nullRatio;
+            for (std::size_t i{0u}; i < count; ++i)
+            {
+                mask[i] = isNull;
+
+                double const leaveProbability = isNull
+                                                  ? 1.0 / (meanRunLength * nullRatio * 2.0)
+                                                  : 1.0 / (meanRunLength * (1.0 - nullRatio) * 2.0);
+                if (0.0 < nullRatio && nullRatio < 1.0 && rng.uniform01() < leaveProbability)
+                {
+                    isNull = !isNull;
+                }
+            }
+            break;
+        }
+
+        case NullDistribution::random:
+        {
+            double blockRatio{};
+            for (std::size_t i{0u}; i < count; ++i)
+            {
+                if (0u == i % 64u)
+                {
+                    blockRatio = rng.uniform01();
+                }
+
+                mask[i] = rng.uniform01() < blockRatio;
+            }
+            break;
+        }
+        }
+
+        return mask;
+    }
+
+    [[nodiscard]]
+    inline std::string describe(
+        std::string_view const kind,
+        std::string_view const type,
+        std::size_t const length,
+        double const nullProbability)
+    {
+        std::string description{" - "};
+        description += kind;
+        description += '<';
+        description += type;
+        description += "> - ";
+        description += std::to_string(length);
+        description += " step(s) - ";
+        description += std::to_string(static_cast<int>(nullProbability * 100.0));
+        description += "% null";
+
+        return description;
+    }
+
+    /**
+     * \brief Runs `fun` on each element of `inputs` and reports the time per element.
+     */
+    template <typename Inputs, typename Fun>
+    void run_over(ankerl::nanobench::Bench& bench, std::string const& name, Inputs const& inputs, Fun fun)
+    {
+        bench.batch(inputs.size())
+            .run(
+                name,
+                [&] {
+                    for (auto const& input : inputs)
+                    {
+                        auto result = fun(input);
+                        ankerl::nanobench::doNotOptimizeAway(result);
+                    }
+                });
+    }
+
+    /**
+     * \brief Creates a pipeline, which consists of `sizeof...(indices)` copies of the given step.
+     */
+    template <typename Step, std::size_t... indices>
+    [[nodiscard]]
+    constexpr auto repeat(Step const& step, [[maybe_unused]] std::index_sequence<indices...> const tag)
+    {
+        return ((static_cast<void>(indices), step) | ...);
+    }
+
+    struct Settings
+    {
+        std::filesystem::path outputDirectory{};
+    };
+
+    [[nodiscard]]
+    inline Settings& settings() noexcept
+    {
+        static Settings instance{};
+        return instance;
+    }
+
+    [[nodiscard]]
+    inline ankerl::nanobench::Bench make_bench(std::string const& title)
+    {
+        ankerl::nanobench::Bench bench{};
+        bench.title(title)
+            .unit("element")
+            .warmup(100)
+            .relative(false)
+            .performanceCounters(true);
+
+        return bench;
+    }
+
+    /**
+     * \brief Writes the results as json and csv into the configured output-directory, if any.
+     */
+    inline void report(ankerl::nanobench::Bench const& bench, std::string_view const name)
+    {
+        std::filesystem::path const& directory = settings().outputDirectory;
+        if (directory.empty())
+        {
+            return;
+        }
+
+        std::filesystem::create_directories(directory);
+        std::ofstream json{directory / (std::string{name} + ".json")};
+        ankerl::nanobench::render(ankerl::nanobench::templates::json(), bench, json);
+        std::ofstream csv{directory / (std::string{name} + ".csv")};
+        ankerl::nanobench::render(ankerl::nanobench::templates::csv(), bench, csv);
+    }
+
+    /**
+     * \brief Returns the number of global allocations, which have been performed so far.
+     */
+    [[nodiscard]]
+    std::size_t allocation_count() noexcept;
+
+    void and_then_suite();
+    void transform_suite();
+    void or_else_suite();
+    void transform_error_suite();
+    void value_or_suite();
+    void value_or_else_suite();
+    void null_distribution_suite();
+    void batch_suite();
+    void bitmap_column_suite();
+    void vectorized_bitmap_column_suite();
+    void parallel_batch_suite();
+    void partition_suite();
+    void pointer_transform_suite();
+    void arena_suite();
+    void compact_optional_suite();
+    void tagged_pointer_suite();
+    void compact_expected_suite();
+    void noexcept_suite();
+    void any_pipeline_suite();
+    void runtime_pipeline_suite();
+    void coroutine_suite();
+    void and_then_async_suite();
+    void lazy_suite();
+    void tracing_suite();
+}
+
+#endif
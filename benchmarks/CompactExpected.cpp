@@ -0,0 +1,140 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#ifdef __cpp_lib_expected
+
+    #include "gimo/algorithm/AndThen.hpp"
+    #include "gimo/algorithm/TransformError.hpp"
+    #include "gimo_ext/CompactExpected.hpp"
+
+    #include <cstddef>
+    #include <cstdint>
+    #include <expected>
+    #include <iostream>
+    #include <string>
+    #include <string_view>
+    #include <system_error>
+    #include <type_traits>
+    #include <utility>
+    #include <vector>
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    struct ErrorCodeKind
+    {
+        using type = std::expected<int, std::error_code>;
+
+        static constexpr std::string_view name{"std::expected<int, std::error_code>"};
+
+        [[nodiscard]]
+        static type make_error(int const code)
+        {
+            return std::unexpected{std::error_code{code, std::generic_category()}};
+        }
+
+        [[nodiscard]]
+        static std::error_code remap(std::error_code const& error) noexcept
+        {
+            return std::error_code{error.value() + 1, error.category()};
+        }
+    };
+
+    struct CompactKind
+    {
+        using type = gimo::CompactExpected<int, std::uint16_t>;
+
+        static constexpr std::string_view name{"gimo::CompactExpected<int, std::uint16_t>"};
+
+        [[nodiscard]]
+        static type make_error(int const code) noexcept
+        {
+            return type::from_error(static_cast<std::uint16_t>(code));
+        }
+
+        [[nodiscard]]
+        static std::uint16_t remap(std::uint16_t const error) noexcept
+        {
+            return static_cast<std::uint16_t>(error + 1u);
+        }
+    };
+
+    template <typename Kind>
+    constexpr auto step = gimo::and_then([](int const value) -> typename Kind::type {
+                              if (value % 97 == 0)
+                              {
+                                  return Kind::make_error(value % 100);
+                              }
+
+                              return value + 1;
+                          })
+                        | gimo::transform_error([](auto const& error) { return Kind::remap(error); });
+
+    template <typename Kind>
+    [[nodiscard]]
+    std::vector<typename Kind::type> make_expected_inputs(double const errorProbability)
+    {
+        ankerl::nanobench::Rng rng{1337u};
+        std::vector<typename Kind::type> inputs{};
+        inputs.reserve(inputCount);
+        for (std::size_t i{0u}; i < inputCount; ++i)
+        {
+            if (rng.uniform01() < errorProbability)
+            {
+                inputs.emplace_back(Kind::make_error(1));
+            }
+            else
+            {
+                inputs.emplace_back(static_cast<int>(i));
+            }
+        }
+
+        return inputs;
+    }
+
+    template <typename Kind, std::size_t length>
+    void run_chain(ankerl::nanobench::Bench& bench, double const errorProbability)
+    {
+        using Expected = typename Kind::type;
+        static constexpr auto pipeline = repeat(step<Kind>, std::make_index_sequence<length>{});
+
+        auto const inputs = make_expected_inputs<Kind>(errorProbability);
+        run_over(
+            bench,
+            "gimo::and_then + gimo::transform_error" + describe(Kind::name, type_name<int>(), length, errorProbability),
+            inputs,
+            [](Expected const& input) { return pipeline.apply(input); });
+    }
+}
+
+void gimo::benchmarks::compact_expected_suite()
+{
+    auto bench = make_bench("compact expected");
+
+    for_each_type<std::tuple<ErrorCodeKind, CompactKind>>([&]<typename Kind>([[maybe_unused]] std::type_identity<Kind> const kind) {
+        std::cout << Kind::name << " - " << sizeof(typename Kind::type) << " bytes; trivially copyable: "
+                  << std::boolalpha << std::is_trivially_copyable_v<typename Kind::type> << ".\n";
+
+        for_each_length(chain_lengths{}, [&]<std::size_t length>([[maybe_unused]] std::integral_constant<std::size_t, length> const) {
+            for (double const errorProbability : nullProbabilities)
+            {
+                run_chain<Kind, length>(bench, errorProbability);
+            }
+        });
+    });
+
+    report(bench, "compact_expected");
+}
+
+#else
+
+void gimo::benchmarks::compact_expected_suite()
+{
+}
+
+#endif
@@ -0,0 +1,78 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo/algorithm/ValueOrElse.hpp"
+#include "gimo_ext/CompactOptional.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    // Exceeds every cache level by far, so that the scan is bound by the memory bandwidth.
+    constexpr std::size_t elementCount{100'000'000u};
+
+    template <typename T>
+    constexpr auto scan = gimo::transform([](T const value) noexcept { return value * T{2}; })
+                        | gimo::value_or(T{});
+
+    template <typename Optional>
+    void run(ankerl::nanobench::Bench& bench, std::string_view const name, std::vector<bool> const& mask)
+    {
+        using Value = typename Optional::value_type;
+
+        std::vector<Optional> inputs(elementCount);
+        for (std::size_t i{0u}; i < elementCount; ++i)
+        {
+            if (!mask[i])
+            {
+                inputs[i] = static_cast<Value>(i % 1'000u);
+            }
+        }
+
+        std::cout << name << " - " << sizeof(Optional) << " bytes per element; "
+                  << sizeof(Optional) * elementCount / (1024u * 1024u) << " MiB in total.\n";
+
+        bench.batch(elementCount)
+            .run(
+                std::string{name},
+                [&] {
+                    Value sum{};
+                    for (Optional const& input : inputs)
+                    {
+                        sum += gimo::apply(input, scan<Value>);
+                    }
+
+                    ankerl::nanobench::doNotOptimizeAway(sum);
+                });
+    }
+}
+
+void gimo::benchmarks::compact_optional_suite()
+{
+    auto bench = make_bench("compact optional");
+    // Each epoch scans the whole vector, which takes long enough on its own.
+    bench.warmup(1)
+        .epochs(5);
+
+    std::vector<bool> const mask = make_null_mask(elementCount, 0.1, NullDistribution::uniform);
+
+    run<std::optional<std::int32_t>>(bench, "std::optional<std::int32_t>", mask);
+    run<CompactOptional<std::int32_t>>(bench, "gimo::CompactOptional<std::int32_t>", mask);
+    run<std::optional<double>>(bench, "std::optional<double>", mask);
+    run<CompactOptional<double>>(bench, "gimo::CompactOptional<double>", mask);
+
+    report(bench, "compact_optional");
+}
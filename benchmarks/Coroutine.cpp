@@ -0,0 +1,162 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/Coroutine.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Each variant validates its input in three dependent steps, where each step may fail.
+ * The steps share some state (`limit`), which has to be captured by each action of the pipeline.
+ */
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    using Input = std::optional<int>;
+
+    [[nodiscard]]
+    Input check_positive(int const value) noexcept
+    {
+        if (value % 97 == 0)
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+
+    [[nodiscard]]
+    Input check_below(int const value, int const limit) noexcept
+    {
+        if (limit <= value % 1024)
+        {
+            return std::nullopt;
+        }
+
+        return value + 1;
+    }
+
+    [[nodiscard]]
+    Input check_even(int const value) noexcept
+    {
+        if (value % 61 == 0)
+        {
+            return std::nullopt;
+        }
+
+        return value * 2;
+    }
+
+    struct EarlyReturnKind
+    {
+        static constexpr std::string_view name{"early return"};
+
+        [[nodiscard]]
+        static Input validate(Input const& input, int const limit) noexcept
+        {
+            if (!input)
+            {
+                return std::nullopt;
+            }
+
+            Input const positive = check_positive(*input);
+            if (!positive)
+            {
+                return std::nullopt;
+            }
+
+            Input const below = check_below(*positive, limit);
+            if (!below)
+            {
+                return std::nullopt;
+            }
+
+            return check_even(*below);
+        }
+    };
+
+    struct PipelineKind
+    {
+        static constexpr std::string_view name{"gimo::and_then"};
+
+        [[nodiscard]]
+        static Input validate(Input const& input, int const limit) noexcept
+        {
+            return gimo::apply(
+                input,
+                gimo::and_then(&check_positive)
+                    | gimo::and_then([limit](int const value) noexcept { return check_below(value, limit); })
+                    | gimo::and_then(&check_even));
+        }
+    };
+
+    struct CoroutineKind
+    {
+        static constexpr std::string_view name{"gimo::Coroutine"};
+
+        [[nodiscard]]
+        static gimo::Coroutine<Input> validate_impl(Input const& input, int const limit)
+        {
+            int const value = co_await input;
+            int const positive = co_await check_positive(value);
+            int const below = co_await check_below(positive, limit);
+
+            co_return co_await check_even(below);
+        }
+
+        [[nodiscard]]
+        static Input validate(Input const& input, int const limit)
+        {
+            return validate_impl(input, limit);
+        }
+    };
+
+    constexpr int limit{1000};
+
+    template <typename Kind>
+    void run(ankerl::nanobench::Bench& bench, double const nullProbability)
+    {
+        auto const inputs = make_inputs<OptionalKind, int>(nullProbability);
+
+        std::size_t const before = allocation_count();
+        for (Input const& input : inputs)
+        {
+            ankerl::nanobench::doNotOptimizeAway(Kind::validate(input, limit));
+        }
+        std::cout << Kind::name << " - global allocations per " << inputs.size() << " elements: "
+                  << allocation_count() - before << ".\n";
+
+        run_over(
+            bench,
+            std::string{Kind::name} + describe(OptionalKind::name, type_name<int>(), 3u, nullProbability),
+            inputs,
+            [](Input const& input) { return Kind::validate(input, limit); });
+    }
+}
+
+void gimo::benchmarks::coroutine_suite()
+{
+    auto bench = make_bench("coroutine");
+
+    for_each_type<std::tuple<EarlyReturnKind, PipelineKind, CoroutineKind>>([&]<typename Kind>([[maybe_unused]] std::type_identity<Kind> const kind) {
+        for (double const nullProbability : nullProbabilities)
+        {
+            run<Kind>(bench, nullProbability);
+        }
+    });
+
+    report(bench, "coroutine");
+}
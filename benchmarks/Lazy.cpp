@@ -0,0 +1,98 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/Lazy.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+
+/*
+ * Mimics log-statements, which format their message via a pipeline, while most messages are filtered out afterwards.
+ * Only every `1 / inspectionRatio`-th result is actually inspected.
+ */
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    using Input = std::optional<int>;
+
+    constexpr auto format = gimo::transform([](int const value) { return "value: " + std::to_string(value); })
+                          | gimo::and_then([](std::string str) -> std::optional<std::string> {
+                                if (str.size() % 7u == 0u)
+                                {
+                                    return std::nullopt;
+                                }
+
+                                str += " (validated)";
+                                return str;
+                            })
+                          | gimo::transform([](std::string const& str) { return str + '\n'; });
+
+    constexpr std::array inspectionRatios{0.1, 0.5, 1.0};
+
+    [[nodiscard]]
+    std::string describe_ratio(double const nullProbability, double const inspectionRatio)
+    {
+        return describe(OptionalKind::name, type_name<int>(), 3u, nullProbability)
+             + " - " + std::to_string(static_cast<int>(inspectionRatio * 100.0)) + "% inspected";
+    }
+}
+
+void gimo::benchmarks::lazy_suite()
+{
+    auto bench = make_bench("lazy");
+
+    for (double const inspectionRatio : inspectionRatios)
+    {
+        auto const stride = static_cast<std::size_t>(1.0 / inspectionRatio);
+        for (double const nullProbability : nullProbabilities)
+        {
+            auto const inputs = make_inputs<OptionalKind, int>(nullProbability);
+
+            bench.batch(inputs.size())
+                .run(
+                    "Pipeline::apply" + describe_ratio(nullProbability, inspectionRatio),
+                    [&] {
+                        std::size_t inspected{};
+                        for (std::size_t i{0u}; i < inputs.size(); ++i)
+                        {
+                            auto const result = format.apply(inputs[i]);
+                            if (0u == i % stride && result)
+                            {
+                                inspected += result->size();
+                            }
+                        }
+
+                        ankerl::nanobench::doNotOptimizeAway(inspected);
+                    });
+
+            bench.batch(inputs.size())
+                .run(
+                    "gimo::lazy" + describe_ratio(nullProbability, inspectionRatio),
+                    [&] {
+                        std::size_t inspected{};
+                        for (std::size_t i{0u}; i < inputs.size(); ++i)
+                        {
+                            auto const result = gimo::lazy(inputs[i], format);
+                            if (0u == i % stride && result.has_value())
+                            {
+                                inspected += result.value().size();
+                            }
+                        }
+
+                        ankerl::nanobench::doNotOptimizeAway(inspected);
+                    });
+        }
+    }
+
+    report(bench, "lazy");
+}
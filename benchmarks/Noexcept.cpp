@@ -0,0 +1,94 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Both chains perform the very same work, but only the nothrow one is `noexcept` as a whole.
+ * The actions call through `volatile` function-pointers, so that the compiler can not deduce the exception-specification on its own.
+ *
+ * That the nothrow chain is free of landing-pads is verified by the `codegen-nothrow-chain` test (see test/codegen).
+ */
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    [[nodiscard]]
+    int increment(int const value) noexcept
+    {
+        return value + 1;
+    }
+
+    struct NothrowKind
+    {
+        static constexpr bool isNothrow{true};
+        static constexpr std::string_view name{"noexcept"};
+
+        static inline int (*volatile operation)(int) noexcept = &increment;
+    };
+
+    struct ThrowingKind
+    {
+        static constexpr bool isNothrow{false};
+        static constexpr std::string_view name{"potentially throwing"};
+
+        static inline int (*volatile operation)(int) = &increment;
+    };
+
+    template <typename Kind>
+    constexpr auto step = gimo::transform([](int const value) noexcept(Kind::isNothrow) { return Kind::operation(value); })
+                        | gimo::and_then([](int const value) noexcept(Kind::isNothrow) -> std::optional<int> {
+                              if (value % 97 == 0)
+                              {
+                                  return std::nullopt;
+                              }
+
+                              return Kind::operation(value);
+                          });
+
+    template <typename Kind, std::size_t length>
+    void run_chain(ankerl::nanobench::Bench& bench, double const nullProbability)
+    {
+        static constexpr auto pipeline = repeat(step<Kind>, std::make_index_sequence<length>{});
+        static_assert(Kind::isNothrow == gimo::nothrow_processable_by<std::optional<int> const&, decltype(pipeline)>);
+
+        auto const inputs = make_inputs<OptionalKind, int>(nullProbability);
+        run_over(
+            bench,
+            "gimo::transform + gimo::and_then" + describe(Kind::name, type_name<int>(), length, nullProbability),
+            inputs,
+            [](std::optional<int> const& input) noexcept(Kind::isNothrow) { return pipeline.apply(input); });
+    }
+}
+
+void gimo::benchmarks::noexcept_suite()
+{
+    auto bench = make_bench("noexcept");
+
+    for_each_type<std::tuple<NothrowKind, ThrowingKind>>([&]<typename Kind>([[maybe_unused]] std::type_identity<Kind> const kind) {
+        std::cout << Kind::name << " - nothrow_processable_by: " << std::boolalpha
+                  << gimo::nothrow_processable_by<std::optional<int> const&, decltype(step<Kind>)> << ".\n";
+
+        for_each_length(chain_lengths{}, [&]<std::size_t length>([[maybe_unused]] std::integral_constant<std::size_t, length> const) {
+            for (double const nullProbability : nullProbabilities)
+            {
+                run_chain<Kind, length>(bench, nullProbability);
+            }
+        });
+    });
+
+    report(bench, "noexcept");
+}
@@ -0,0 +1,145 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <vector>
+
+/*
+ * These scenarios run the same pipeline over a large array of nullables,
+ * whose null elements follow different ratios and distributions.
+ * As the null-state changes from element to element, the branch-predictor can not simply learn a single outcome.
+ * The reported branch-misses (via nanobench's performance-counters; Linux only) reveal,
+ * how well each approach copes with that.
+ */
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    constexpr std::size_t elementCount{1u << 16u};
+
+    struct Step
+    {
+        [[nodiscard]]
+        constexpr std::optional<int> operator()(int const value) const noexcept
+        {
+            // Produces nulls on its own, so that subsequent steps have to test again.
+            if (value % 97 == 0)
+            {
+                return std::nullopt;
+            }
+
+            return value + 1;
+        }
+    };
+
+    [[nodiscard]]
+    std::vector<std::optional<int>> make_distributed_inputs(double const nullRatio, NullDistribution const distribution)
+    {
+        std::vector<bool> const mask = make_null_mask(elementCount, nullRatio, distribution);
+
+        std::vector<std::optional<int>> inputs{};
+        inputs.reserve(elementCount);
+        for (std::size_t i{0u}; i < elementCount; ++i)
+        {
+            if (mask[i])
+            {
+                inputs.emplace_back(std::nullopt);
+            }
+            else
+            {
+                inputs.emplace_back(static_cast<int>(i));
+            }
+        }
+
+        return inputs;
+    }
+
+    void run(ankerl::nanobench::Bench& bench, NullDistribution const distribution, double const nullRatio = 0.0)
+    {
+        static constexpr auto pipeline = gimo::and_then(Step{})
+                                       | gimo::and_then(Step{})
+                                       | gimo::transform([](int const value) noexcept { return value * 2; })
+                                       | gimo::and_then(Step{});
+
+        auto const inputs = make_distributed_inputs(nullRatio, distribution);
+        std::string suffix{" - "};
+        if (NullDistribution::random != distribution)
+        {
+            suffix += std::to_string(static_cast<int>(nullRatio * 100.0));
+            suffix += "% null - ";
+        }
+        suffix += distribution_name(distribution);
+
+        run_over(
+            bench,
+            "std::optional::and_then" + suffix,
+            inputs,
+            [](std::optional<int> const& input) {
+                return input.and_then(Step{})
+                    .and_then(Step{})
+                    .transform([](int const value) noexcept { return value * 2; })
+                    .and_then(Step{});
+            });
+
+        run_over(
+            bench,
+            "handwritten if" + suffix,
+            inputs,
+            [](std::optional<int> const& input) -> std::optional<int> {
+                if (!input)
+                {
+                    return std::nullopt;
+                }
+
+                auto first = Step{}(*input);
+                if (!first)
+                {
+                    return std::nullopt;
+                }
+
+                auto second = Step{}(*first);
+                if (!second)
+                {
+                    return std::nullopt;
+                }
+
+                return Step{}(*second * 2);
+            });
+
+        run_over(
+            bench,
+            "gimo::and_then" + suffix,
+            inputs,
+            [](std::optional<int> const& input) { return pipeline.apply(input); });
+    }
+}
+
+void gimo::benchmarks::null_distribution_suite()
+{
+    auto bench = make_bench("null distribution");
+
+    constexpr std::array nullRatios{0.0, 0.01, 0.1, 0.5};
+    for (NullDistribution const distribution : {NullDistribution::uniform, NullDistribution::clustered})
+    {
+        for (double const nullRatio : nullRatios)
+        {
+            run(bench, distribution, nullRatio);
+        }
+    }
+
+    run(bench, NullDistribution::random);
+
+    report(bench, "null_distribution");
+}
@@ -0,0 +1,124 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/algorithm/OrElse.hpp"
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    template <typename Nullable>
+    struct Fallback
+    {
+        [[nodiscard]]
+        Nullable operator()() const
+        {
+            return Nullable{make_value<typename Nullable::value_type>(42u)};
+        }
+    };
+
+    template <typename Nullable, typename Action>
+    [[nodiscard]]
+    auto member_or_else(Nullable&& nullable, Action const& action)
+    {
+        // std::expected::or_else passes the error to the action.
+        if constexpr (requires { nullable.error(); })
+        {
+            return std::forward<Nullable>(nullable).or_else([&]([[maybe_unused]] auto&& error) { return action(); });
+        }
+        else
+        {
+            return std::forward<Nullable>(nullable).or_else(action);
+        }
+    }
+
+    template <std::size_t length, typename Nullable, typename Action>
+    [[nodiscard]]
+    auto member_chain(Nullable&& nullable, Action const& action)
+    {
+        if constexpr (1u == length)
+        {
+            return member_or_else(std::forward<Nullable>(nullable), action);
+        }
+        else
+        {
+            return member_or_else(member_chain<length - 1u>(std::forward<Nullable>(nullable), action), action);
+        }
+    }
+
+    template <std::size_t length, typename Nullable, typename Action>
+    [[nodiscard]]
+    std::remove_cvref_t<Nullable> handwritten_chain(Nullable const& nullable, Action const& action)
+    {
+        if (nullable)
+        {
+            return nullable;
+        }
+
+        auto current = action();
+        for (std::size_t i{1u}; i < length && !current; ++i)
+        {
+            current = action();
+        }
+
+        return current;
+    }
+
+    template <typename Kind, typename T, std::size_t length>
+    void run_chain(ankerl::nanobench::Bench& bench, double const nullProbability)
+    {
+        using Nullable = typename Kind::template type<T>;
+        static constexpr auto pipeline = repeat(gimo::or_else(Fallback<Nullable>{}), std::make_index_sequence<length>{});
+
+        auto const inputs = make_inputs<Kind, T>(nullProbability);
+        std::string const suffix = describe(Kind::name, type_name<T>(), length, nullProbability);
+
+        if constexpr (has_monadic_members<Nullable>)
+        {
+            run_over(
+                bench,
+                "member or_else" + suffix,
+                inputs,
+                [](Nullable const& input) { return member_chain<length>(input, Fallback<Nullable>{}); });
+        }
+
+        run_over(
+            bench,
+            "handwritten if" + suffix,
+            inputs,
+            [](Nullable const& input) { return handwritten_chain<length>(input, Fallback<Nullable>{}); });
+
+        run_over(
+            bench,
+            "gimo::or_else" + suffix,
+            inputs,
+            [](Nullable const& input) { return pipeline.apply(input); });
+    }
+}
+
+void gimo::benchmarks::or_else_suite()
+{
+    auto bench = make_bench("or_else");
+
+    for_each_type<nullable_kinds>([&]<typename Kind>([[maybe_unused]] std::type_identity<Kind> const kind) {
+        for_each_type<value_types>([&]<typename T>([[maybe_unused]] std::type_identity<T> const type) {
+            for_each_length(chain_lengths{}, [&]<std::size_t length>([[maybe_unused]] std::integral_constant<std::size_t, length> const) {
+                for (double const nullProbability : nullProbabilities)
+                {
+                    run_chain<Kind, T, length>(bench, nullProbability);
+                }
+            });
+        });
+    });
+
+    report(bench, "or_else");
+}
@@ -0,0 +1,148 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/ParallelBatch.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if __has_include(<execution>)
+    #include <execution>
+#endif
+
+#if defined(__cpp_lib_expected) && defined(__cpp_lib_execution)
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    constexpr std::size_t recordCount{1u << 22u};
+
+    struct Record
+    {
+        std::size_t id{};
+        double amount{};
+    };
+
+    enum class Error
+    {
+        missing,
+        negative
+    };
+
+    using Input = std::expected<Record, Error>;
+    using Output = std::expected<double, Error>;
+
+    constexpr auto recordPipeline = gimo::and_then([](Record const& record) noexcept -> Input {
+                                        if (record.amount < 0.0)
+                                        {
+                                            return std::unexpected{Error::negative};
+                                        }
+
+                                        return record;
+                                    })
+                                  | gimo::transform([](Record const& record) noexcept { return record.amount * 1.19; });
+
+    [[nodiscard]]
+    std::vector<Input> make_records()
+    {
+        std::vector<bool> const mask = make_null_mask(recordCount, 0.1, NullDistribution::uniform);
+        std::vector<Input> records{};
+        records.reserve(recordCount);
+        for (std::size_t i{0u}; i < recordCount; ++i)
+        {
+            if (mask[i])
+            {
+                records.emplace_back(std::unexpect, Error::missing);
+            }
+            else
+            {
+                records.emplace_back(Record{.id = i, .amount = static_cast<double>(i % 1000u) - 100.0});
+            }
+        }
+
+        return records;
+    }
+
+    /**
+     * \brief Splits the inputs into equally sized chunks, each processed by its own thread, which share the pipeline.
+     */
+    void apply_chunked(std::span<Input const> const inputs, std::span<Output> const outputs, std::size_t const threadCount)
+    {
+        std::size_t const chunkSize = (inputs.size() + threadCount - 1u) / threadCount;
+
+        std::vector<std::jthread> threads{};
+        threads.reserve(threadCount);
+        for (std::size_t offset{0u}; offset < inputs.size(); offset += chunkSize)
+        {
+            std::size_t const count = std::min(chunkSize, inputs.size() - offset);
+            threads.emplace_back([=] {
+                gimo::apply_each(inputs.subspan(offset, count), recordPipeline, outputs.subspan(offset, count).begin());
+            });
+        }
+    }
+}
+
+void gimo::benchmarks::parallel_batch_suite()
+{
+    auto bench = make_bench("parallel batch");
+
+    std::vector<Input> const inputs = make_records();
+    std::vector<Output> outputs(inputs.size());
+
+    bench.batch(inputs.size())
+        .run(
+            "gimo::apply_each",
+            [&] {
+                gimo::apply_each(inputs, recordPipeline, outputs.begin());
+                ankerl::nanobench::doNotOptimizeAway(outputs.data());
+            });
+
+    bench.batch(inputs.size())
+        .run(
+            "gimo::apply_each(std::execution::par)",
+            [&] {
+                gimo::apply_each(std::execution::par, inputs, recordPipeline, outputs.begin());
+                ankerl::nanobench::doNotOptimizeAway(outputs.data());
+            });
+
+    bench.batch(inputs.size())
+        .run(
+            "gimo::apply_each(std::execution::par_unseq)",
+            [&] {
+                gimo::apply_each(std::execution::par_unseq, inputs, recordPipeline, outputs.begin());
+                ankerl::nanobench::doNotOptimizeAway(outputs.data());
+            });
+
+    std::size_t const maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t threadCount{1u}; threadCount <= maxThreads; threadCount *= 2u)
+    {
+        bench.batch(inputs.size())
+            .run(
+                "chunked gimo::apply_each - " + std::to_string(threadCount) + " thread(s)",
+                [&] {
+                    apply_chunked(inputs, outputs, threadCount);
+                    ankerl::nanobench::doNotOptimizeAway(outputs.data());
+                });
+    }
+
+    report(bench, "parallel_batch");
+}
+
+#else
+
+void gimo::benchmarks::parallel_batch_suite()
+{
+}
+
+#endif
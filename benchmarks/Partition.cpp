@@ -0,0 +1,118 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/Batch.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#ifdef __cpp_lib_expected
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    constexpr std::size_t batchSize{1u << 16u};
+
+    using Expected = std::expected<int, int>;
+
+    constexpr auto partitioning = gimo::transform(Increment{})
+                                | gimo::and_then([](int const value) noexcept -> Expected {
+                                      if (value % 7 == 0)
+                                      {
+                                          return std::unexpected{value};
+                                      }
+
+                                      return value;
+                                  });
+
+    void run(ankerl::nanobench::Bench& bench, double const errorRatio, NullDistribution const distribution)
+    {
+        std::vector<bool> const mask = make_null_mask(batchSize, errorRatio, distribution);
+        std::vector<Expected> inputs{};
+        inputs.reserve(batchSize);
+        for (std::size_t i{0u}; i < batchSize; ++i)
+        {
+            if (mask[i])
+            {
+                inputs.emplace_back(std::unexpect, -1);
+            }
+            else
+            {
+                inputs.emplace_back(static_cast<int>(i));
+            }
+        }
+
+        std::vector<Expected> results(batchSize);
+        std::vector<int> values(batchSize);
+        std::vector<int> errors(batchSize);
+
+        std::string suffix{" - "};
+        suffix += std::to_string(static_cast<int>(errorRatio * 100.0));
+        suffix += "% error - ";
+        suffix += distribution_name(distribution);
+
+        bench.batch(batchSize)
+            .run(
+                "apply_each + split" + suffix,
+                [&] {
+                    gimo::apply_each(inputs, partitioning, results.begin());
+
+                    std::size_t valueCount{0u};
+                    std::size_t errorCount{0u};
+                    for (Expected const& result : results)
+                    {
+                        if (result)
+                        {
+                            values[valueCount++] = *result;
+                        }
+                        else
+                        {
+                            errors[errorCount++] = result.error();
+                        }
+                    }
+
+                    ankerl::nanobench::doNotOptimizeAway(valueCount);
+                    ankerl::nanobench::doNotOptimizeAway(errorCount);
+                });
+
+        bench.batch(batchSize)
+            .run(
+                "gimo::partition_each" + suffix,
+                [&] {
+                    auto const result = gimo::partition_each(inputs, partitioning, values.begin(), errors.begin());
+                    ankerl::nanobench::doNotOptimizeAway(result.valueCount);
+                    ankerl::nanobench::doNotOptimizeAway(result.errorCount);
+                });
+    }
+}
+
+void gimo::benchmarks::partition_suite()
+{
+    auto bench = make_bench("partition");
+
+    for (NullDistribution const distribution : {NullDistribution::uniform, NullDistribution::clustered})
+    {
+        for (double const errorRatio : {0.01, 0.1, 0.5})
+        {
+            run(bench, errorRatio, distribution);
+        }
+    }
+
+    report(bench, "partition");
+}
+
+#else
+
+void gimo::benchmarks::partition_suite()
+{
+}
+
+#endif
@@ -0,0 +1,69 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdUniquePtr.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    constexpr auto chain = gimo::transform(Increment{})
+                         | gimo::transform(Increment{})
+                         | gimo::transform(Increment{})
+                         | gimo::transform(Increment{})
+                         | gimo::transform(Increment{});
+
+    template <typename Fun>
+    [[nodiscard]]
+    std::size_t count_allocations(Fun&& fun)
+    {
+        std::size_t const before = allocation_count();
+        ankerl::nanobench::doNotOptimizeAway(std::forward<Fun>(fun)());
+        return allocation_count() - before;
+    }
+
+    template <typename Pointer, typename Make>
+    void run(ankerl::nanobench::Bench& bench, std::string_view const typeName, Make const& make)
+    {
+        // Emulates the behaviour, where each step allocates a new object.
+        auto const rebinding = [&] {
+            Pointer ptr = make(42);
+            for (int i{0}; i < 5; ++i)
+            {
+                ptr = make(Increment{}(*ptr));
+            }
+
+            return ptr;
+        };
+        auto const inPlace = [&] { return gimo::apply(make(42), chain); };
+
+        std::cout << typeName << " - allocations per 5-step transform chain: "
+                  << "rebinding " << count_allocations(rebinding) << "; "
+                  << "gimo " << count_allocations(inPlace) << ".\n";
+
+        std::string const suffix = std::string{" - "} + std::string{typeName};
+        bench.run("rebinding" + suffix, [&] { ankerl::nanobench::doNotOptimizeAway(rebinding()); });
+        bench.run("gimo" + suffix, [&] { ankerl::nanobench::doNotOptimizeAway(inPlace()); });
+    }
+}
+
+void gimo::benchmarks::pointer_transform_suite()
+{
+    auto bench = make_bench("pointer transform");
+
+    run<std::unique_ptr<int>>(bench, "std::unique_ptr", [](int const value) { return std::make_unique<int>(value); });
+
+    report(bench, "pointer_transform");
+}
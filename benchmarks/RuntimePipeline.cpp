@@ -0,0 +1,100 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/RuntimePipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    using Input = std::optional<int>;
+    using Function = std::function<Input(Input)>;
+
+    constexpr auto step = gimo::and_then([](int const value) noexcept -> Input {
+        if (value % 97 == 0)
+        {
+            return std::nullopt;
+        }
+
+        return value + 1;
+    });
+
+    /**
+     * \brief Composes the steps, as it's commonly done without any runtime pipeline: each step wraps the previous one.
+     */
+    [[nodiscard]]
+    Function make_nested_function(std::size_t const length)
+    {
+        Function function = [](Input input) { return input; };
+        for (std::size_t i{0u}; i < length; ++i)
+        {
+            function = [inner = std::move(function)](Input input) { return step.apply(inner(std::move(input))); };
+        }
+
+        return function;
+    }
+
+    [[nodiscard]]
+    gimo::RuntimePipeline<Input> make_runtime_pipeline(std::size_t const length)
+    {
+        std::vector<gimo::ErasedStep<Input>> steps{};
+        steps.reserve(length);
+        for (std::size_t i{0u}; i < length; ++i)
+        {
+            steps.emplace_back(step);
+        }
+
+        return gimo::RuntimePipeline<Input>{std::move(steps)};
+    }
+
+    template <std::size_t length>
+    void run_chain(ankerl::nanobench::Bench& bench, double const nullProbability)
+    {
+        static constexpr auto pipeline = repeat(step, std::make_index_sequence<length>{});
+        Function const nested = make_nested_function(length);
+        gimo::RuntimePipeline<Input> const runtime = make_runtime_pipeline(length);
+
+        auto const inputs = make_inputs<OptionalKind, int>(nullProbability);
+        run_over(
+            bench,
+            "Pipeline::apply" + describe(OptionalKind::name, type_name<int>(), length, nullProbability),
+            inputs,
+            [](Input const& input) { return pipeline.apply(input); });
+        run_over(
+            bench,
+            "gimo::RuntimePipeline" + describe(OptionalKind::name, type_name<int>(), length, nullProbability),
+            inputs,
+            [&](Input const& input) { return runtime.apply(input); });
+        run_over(
+            bench,
+            "nested std::function" + describe(OptionalKind::name, type_name<int>(), length, nullProbability),
+            inputs,
+            [&](Input const& input) { return nested(input); });
+    }
+}
+
+void gimo::benchmarks::runtime_pipeline_suite()
+{
+    auto bench = make_bench("runtime pipeline");
+
+    for_each_length(chain_lengths{}, [&]<std::size_t length>([[maybe_unused]] std::integral_constant<std::size_t, length> const) {
+        for (double const nullProbability : nullProbabilities)
+        {
+            run_chain<length>(bench, nullProbability);
+        }
+    });
+
+    report(bench, "runtime_pipeline");
+}
@@ -0,0 +1,130 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/TransformError.hpp"
+#include "gimo/algorithm/ValueOrElse.hpp"
+#include "gimo_ext/TaggedPointer.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef __cpp_lib_expected
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    constexpr std::size_t nodeCount{1u << 16u};
+
+    enum class ErrCode : std::int32_t
+    {
+        dead_end = 1,
+        unreachable = 2
+    };
+
+    struct Node
+    {
+        std::size_t value{};
+        Node* next{};
+    };
+
+    /**
+     * \brief Links the nodes in a random order, so that the hardware prefetcher can't anticipate the traversal.
+     * \details Each node, which is selected by the mask, becomes a dead end.
+     */
+    [[nodiscard]]
+    std::vector<Node> make_graph(std::vector<bool> const& mask)
+    {
+        std::vector<Node> nodes(nodeCount);
+        std::vector<std::size_t> order(nodeCount);
+        std::iota(order.begin(), order.end(), std::size_t{0u});
+        std::ranges::shuffle(order, std::mt19937_64{42u});
+
+        for (std::size_t i{0u}; i < nodeCount; ++i)
+        {
+            Node& node = nodes[order[i]];
+            node.value = i;
+            if (!mask[i])
+            {
+                node.next = &nodes[order[(i + 1u) % nodeCount]];
+            }
+        }
+
+        return nodes;
+    }
+
+    template <typename Result>
+    constexpr auto hop = gimo::and_then([](Node* const node) noexcept -> Result {
+        if (!node->next)
+        {
+            return gimo::traits<Result>::from_error(ErrCode::dead_end);
+        }
+
+        return node->next;
+    });
+
+    template <typename Result>
+    constexpr auto traversal = hop<Result>
+                             | hop<Result>
+                             | hop<Result>
+                             | hop<Result>
+                             | gimo::transform_error([](ErrCode const error) noexcept {
+                                   return error == ErrCode::dead_end ? ErrCode::unreachable : error;
+                               })
+                             | gimo::value_or(static_cast<Node*>(nullptr));
+
+    template <typename Result>
+    void run(ankerl::nanobench::Bench& bench, std::string_view const name, std::vector<Node>& nodes)
+    {
+        std::cout << name << " - " << sizeof(Result) << " bytes per result.\n";
+
+        bench.batch(nodeCount)
+            .run(
+                std::string{name},
+                [&] {
+                    std::size_t sum{};
+                    for (Node& node : nodes)
+                    {
+                        if (Node const* const target = gimo::apply(Result{&node}, traversal<Result>))
+                        {
+                            sum += target->value;
+                        }
+                    }
+
+                    ankerl::nanobench::doNotOptimizeAway(sum);
+                });
+    }
+}
+
+void gimo::benchmarks::tagged_pointer_suite()
+{
+    auto bench = make_bench("tagged pointer");
+
+    std::vector<bool> const mask = make_null_mask(nodeCount, 0.1, NullDistribution::uniform);
+    std::vector<Node> nodes = make_graph(mask);
+
+    run<std::expected<Node*, ErrCode>>(bench, "std::expected<Node*, ErrCode>", nodes);
+    run<TaggedPointer<Node, ErrCode>>(bench, "gimo::TaggedPointer<Node, ErrCode>", nodes);
+
+    report(bench, "tagged_pointer");
+}
+
+#else
+
+void gimo::benchmarks::tagged_pointer_suite()
+{
+}
+
+#endif
@@ -0,0 +1,68 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/Tracing.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+
+#include <concepts>
+#include <optional>
+#include <string>
+
+/*
+ * This translation-unit is compiled with `GIMO_TRACE=0` (see the CMakeLists.txt), i.e. the traced pipeline is compiled out.
+ * Both variants are thus expected to perform identically; any difference is measurement noise.
+ */
+static_assert(0 == GIMO_TRACE, "The tracing benchmark must be compiled with tracing disabled.");
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    using Input = std::optional<int>;
+
+    constexpr auto chain = gimo::transform([](int const value) noexcept { return value + 1; })
+                         | gimo::and_then([](int const value) noexcept { return value % 3 == 0 ? std::nullopt : std::optional{value}; })
+                         | gimo::transform([](int const value) noexcept { return value * 2; });
+}
+
+void gimo::benchmarks::tracing_suite()
+{
+    auto bench = make_bench("tracing");
+
+    TraceSink sink{};
+    auto const traced = gimo::traced(chain, sink);
+    static_assert(std::same_as<decltype(chain), decltype(traced)>);
+
+    for (double const nullProbability : nullProbabilities)
+    {
+        auto const inputs = make_inputs<OptionalKind, int>(nullProbability);
+        std::string const description = describe(OptionalKind::name, type_name<int>(), 3u, nullProbability);
+
+        bench.batch(inputs.size())
+            .run(
+                "Pipeline::apply (baseline)" + description,
+                [&] {
+                    for (Input const& input : inputs)
+                    {
+                        ankerl::nanobench::doNotOptimizeAway(chain.apply(input));
+                    }
+                });
+
+        bench.batch(inputs.size())
+            .run(
+                "gimo::traced (GIMO_TRACE=0)" + description,
+                [&] {
+                    for (Input const& input : inputs)
+                    {
+                        ankerl::nanobench::doNotOptimizeAway(traced.apply(input));
+                    }
+                });
+    }
+
+    report(bench, "tracing");
+}
@@ -0,0 +1,202 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/algorithm/Transform.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    std::size_t constructions{0u};
+
+    template <typename T>
+    class ConstructionCounter
+    {
+    public:
+        explicit(false) ConstructionCounter(std::nullopt_t const null) noexcept
+            : m_Value{null}
+        {
+            ++constructions;
+        }
+
+        explicit ConstructionCounter(T value)
+            : m_Value{std::move(value)}
+        {
+            ++constructions;
+        }
+
+        ConstructionCounter(ConstructionCounter&& other) noexcept
+            : m_Value{std::move(other.m_Value)}
+        {
+            ++constructions;
+        }
+
+        ConstructionCounter& operator=(std::nullopt_t const null) noexcept
+        {
+            m_Value = null;
+            return *this;
+        }
+
+        [[nodiscard]]
+        T const& operator*() const&
+        {
+            return *m_Value;
+        }
+
+        [[nodiscard]]
+        T&& operator*() &&
+        {
+            return *std::move(m_Value);
+        }
+
+        [[nodiscard]]
+        friend bool operator==(ConstructionCounter const& counter, std::nullopt_t const null) noexcept
+        {
+            return counter.m_Value == null;
+        }
+
+    private:
+        std::optional<T> m_Value;
+    };
+}
+
+template <typename T>
+struct gimo::traits<ConstructionCounter<T>>
+{
+    static constexpr std::nullopt_t null{std::nullopt};
+
+    template <typename V>
+    using rebind_value = ConstructionCounter<V>;
+};
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    template <std::size_t length, typename Nullable, typename Action>
+    [[nodiscard]]
+    auto member_chain(Nullable&& nullable, Action const& action)
+    {
+        if constexpr (1u == length)
+        {
+            return std::forward<Nullable>(nullable).transform(action);
+        }
+        else
+        {
+            return member_chain<length - 1u>(std::forward<Nullable>(nullable), action).transform(action);
+        }
+    }
+
+    template <std::size_t length, typename Nullable, typename Action>
+    [[nodiscard]]
+    std::remove_cvref_t<Nullable> handwritten_chain(Nullable const& nullable, Action const& action)
+    {
+        if (!nullable)
+        {
+            return nullable;
+        }
+
+        auto value = action(*nullable);
+        for (std::size_t i{1u}; i < length; ++i)
+        {
+            value = action(value);
+        }
+
+        return std::remove_cvref_t<Nullable>{std::move(value)};
+    }
+
+    template <typename Kind, typename T, std::size_t length>
+    void run_chain(ankerl::nanobench::Bench& bench, double const nullProbability)
+    {
+        using Nullable = typename Kind::template type<T>;
+        static constexpr auto pipeline = repeat(gimo::transform(Increment{}), std::make_index_sequence<length>{});
+
+        auto const inputs = make_inputs<Kind, T>(nullProbability);
+        std::string const suffix = describe(Kind::name, type_name<T>(), length, nullProbability);
+
+        if constexpr (has_monadic_members<Nullable>)
+        {
+            run_over(
+                bench,
+                "member transform" + suffix,
+                inputs,
+                [](Nullable const& input) { return member_chain<length>(input, Increment{}); });
+        }
+
+        run_over(
+            bench,
+            "handwritten if" + suffix,
+            inputs,
+            [](Nullable const& input) { return handwritten_chain<length>(input, Increment{}); });
+
+        run_over(
+            bench,
+            "gimo::transform" + suffix,
+            inputs,
+            [](Nullable const& input) { return pipeline.apply(input); });
+    }
+
+    /**
+     * \brief Measures the null-path, where gimo fast-forwards the null-state over the whole chain.
+     */
+    template <std::size_t length>
+    void null_fast_forward_chain(ankerl::nanobench::Bench& bench)
+    {
+        static constexpr auto pipeline = repeat(gimo::transform(Increment{}), std::make_index_sequence<length>{});
+        std::string const suffix = " - " + std::to_string(length) + " steps - with nullopt";
+
+        ConstructionCounter<std::string> const counter{std::nullopt};
+        constructions = 0u;
+        [[maybe_unused]] auto const counted = pipeline.apply(counter);
+        std::cout << "gimo::transform chain with " << length << " steps constructs "
+                  << constructions << " nullable(s) on the null-path.\n";
+
+        std::optional<std::string> const opt{};
+        bench.batch(1u)
+            .run(
+                "std::optional::transform" + suffix,
+                [&] {
+                    auto r = member_chain<length>(opt, Increment{});
+                    ankerl::nanobench::doNotOptimizeAway(r);
+                });
+
+        bench.batch(1u)
+            .run(
+                "gimo::transform" + suffix,
+                [&] {
+                    auto r = pipeline.apply(opt);
+                    ankerl::nanobench::doNotOptimizeAway(r);
+                });
+    }
+}
+
+void gimo::benchmarks::transform_suite()
+{
+    auto bench = make_bench("transform");
+
+    for_each_type<nullable_kinds>([&]<typename Kind>([[maybe_unused]] std::type_identity<Kind> const kind) {
+        for_each_type<value_types>([&]<typename T>([[maybe_unused]] std::type_identity<T> const type) {
+            for_each_length(chain_lengths{}, [&]<std::size_t length>([[maybe_unused]] std::integral_constant<std::size_t, length> const) {
+                for (double const nullProbability : nullProbabilities)
+                {
+                    run_chain<Kind, T, length>(bench, nullProbability);
+                }
+            });
+        });
+    });
+
+    null_fast_forward_chain<3u>(bench);
+    null_fast_forward_chain<8u>(bench);
+    null_fast_forward_chain<16u>(bench);
+
+    report(bench, "transform");
+}
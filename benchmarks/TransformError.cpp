@@ -0,0 +1,147 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#ifdef __cpp_lib_expected
+
+    #include "gimo/algorithm/TransformError.hpp"
+
+    #include <cstddef>
+    #include <expected>
+    #include <string>
+    #include <type_traits>
+    #include <utility>
+    #include <vector>
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    /**
+     * \brief Expected-like kind, where the error-type varies instead of the value-type.
+     */
+    struct ErrorKind
+    {
+        template <typename E>
+        using type = std::expected<int, E>;
+
+        static constexpr std::string_view name{"std::expected<int, E>"};
+    };
+
+    template <typename E>
+    [[nodiscard]]
+    std::vector<ErrorKind::type<E>> make_error_inputs(double const errorProbability)
+    {
+        ankerl::nanobench::Rng rng{1337u};
+        std::vector<ErrorKind::type<E>> inputs{};
+        inputs.reserve(inputCount);
+        for (std::size_t i{0u}; i < inputCount; ++i)
+        {
+            if (rng.uniform01() < errorProbability)
+            {
+                inputs.emplace_back(std::unexpect, make_value<E>(i));
+            }
+            else
+            {
+                inputs.emplace_back(static_cast<int>(i));
+            }
+        }
+
+        return inputs;
+    }
+
+    template <typename Expected>
+    concept has_transform_error_member = requires(Expected const& expected) {
+        expected.transform_error(Increment{});
+    };
+
+    template <std::size_t length, typename Expected, typename Action>
+    [[nodiscard]]
+    auto member_chain(Expected&& expected, Action const& action)
+    {
+        if constexpr (1u == length)
+        {
+            return std::forward<Expected>(expected).transform_error(action);
+        }
+        else
+        {
+            return member_chain<length - 1u>(std::forward<Expected>(expected), action).transform_error(action);
+        }
+    }
+
+    template <std::size_t length, typename Expected, typename Action>
+    [[nodiscard]]
+    std::remove_cvref_t<Expected> handwritten_chain(Expected const& expected, Action const& action)
+    {
+        if (expected)
+        {
+            return expected;
+        }
+
+        auto error = action(expected.error());
+        for (std::size_t i{1u}; i < length; ++i)
+        {
+            error = action(error);
+        }
+
+        return std::unexpected{std::move(error)};
+    }
+
+    template <typename E, std::size_t length>
+    void run_chain(ankerl::nanobench::Bench& bench, double const errorProbability)
+    {
+        using Expected = ErrorKind::type<E>;
+        static constexpr auto pipeline = repeat(gimo::transform_error(Increment{}), std::make_index_sequence<length>{});
+
+        auto const inputs = make_error_inputs<E>(errorProbability);
+        std::string const suffix = describe(ErrorKind::name, type_name<E>(), length, errorProbability);
+
+        if constexpr (has_transform_error_member<Expected>)
+        {
+            run_over(
+                bench,
+                "member transform_error" + suffix,
+                inputs,
+                [](Expected const& input) { return member_chain<length>(input, Increment{}); });
+        }
+
+        run_over(
+            bench,
+            "handwritten if" + suffix,
+            inputs,
+            [](Expected const& input) { return handwritten_chain<length>(input, Increment{}); });
+
+        run_over(
+            bench,
+            "gimo::transform_error" + suffix,
+            inputs,
+            [](Expected const& input) { return pipeline.apply(input); });
+    }
+}
+
+void gimo::benchmarks::transform_error_suite()
+{
+    auto bench = make_bench("transform_error");
+
+    for_each_type<value_types>([&]<typename E>([[maybe_unused]] std::type_identity<E> const type) {
+        for_each_length(chain_lengths{}, [&]<std::size_t length>([[maybe_unused]] std::integral_constant<std::size_t, length> const) {
+            for (double const errorProbability : nullProbabilities)
+            {
+                run_chain<E, length>(bench, errorProbability);
+            }
+        });
+    });
+
+    report(bench, "transform_error");
+}
+
+#else
+
+void gimo::benchmarks::transform_error_suite()
+{
+}
+
+#endif
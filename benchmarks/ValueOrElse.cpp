@@ -0,0 +1,65 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/algorithm/ValueOrElse.hpp"
+
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    template <typename T>
+    struct Fallback
+    {
+        [[nodiscard]]
+        T operator()() const
+        {
+            return make_value<T>(42u);
+        }
+    };
+
+    template <typename Kind, typename T>
+    void run(ankerl::nanobench::Bench& bench, double const nullProbability)
+    {
+        using Nullable = typename Kind::template type<T>;
+        static constexpr auto pipeline = gimo::value_or_else(Fallback<T>{});
+
+        auto const inputs = make_inputs<Kind, T>(nullProbability);
+        std::string const suffix = describe(Kind::name, type_name<T>(), 1u, nullProbability);
+
+        // There is no member equivalent, as std::optional::value_or evaluates its alternative eagerly.
+        run_over(
+            bench,
+            "handwritten if" + suffix,
+            inputs,
+            [](Nullable const& input) { return input ? *input : Fallback<T>{}(); });
+
+        run_over(
+            bench,
+            "gimo::value_or_else" + suffix,
+            inputs,
+            [](Nullable const& input) { return pipeline.apply(input); });
+    }
+}
+
+void gimo::benchmarks::value_or_else_suite()
+{
+    auto bench = make_bench("value_or_else");
+
+    for_each_type<nullable_kinds>([&]<typename Kind>([[maybe_unused]] std::type_identity<Kind> const kind) {
+        for_each_type<value_types>([&]<typename T>([[maybe_unused]] std::type_identity<T> const type) {
+            for (double const nullProbability : nullProbabilities)
+            {
+                run<Kind, T>(bench, nullProbability);
+            }
+        });
+    });
+
+    report(bench, "value_or_else");
+}
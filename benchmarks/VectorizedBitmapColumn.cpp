@@ -0,0 +1,114 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "Commons.hpp"
+
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo/algorithm/ValueOrElse.hpp"
+#include "gimo_ext/BitmapColumn.hpp"
+#include "gimo_ext/VectorizedBitmapColumn.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*
+ * Compares the vectorized and the regular execution over a column.
+ * The instruction-set is determined by the build; configure with `GIMO_BENCHMARKS_ENABLE_AVX2=ON`
+ * to compare an AVX2 build with the default (SSE2-only on x86-64) build.
+ */
+
+namespace
+{
+    using namespace gimo::benchmarks;
+
+    constexpr std::size_t columnSize{1u << 16u};
+
+    [[nodiscard]]
+    constexpr std::string_view instruction_set() noexcept
+    {
+#if defined(__AVX512F__)
+        return "AVX512";
+#elif defined(__AVX2__)
+        return "AVX2";
+#elif defined(__SSE2__) || defined(_M_X64)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+
+    template <typename T>
+    [[nodiscard]]
+    gimo::BitmapColumn<T> make_column(double const nullRatio)
+    {
+        std::vector<bool> const mask = make_null_mask(columnSize, nullRatio, NullDistribution::uniform);
+        gimo::BitmapColumn<T> column(columnSize);
+        for (std::size_t i{0u}; i < columnSize; ++i)
+        {
+            if (!mask[i])
+            {
+                column.set(i, static_cast<T>(i));
+            }
+        }
+
+        return column;
+    }
+
+    template <typename T, typename Pipeline>
+    void run(ankerl::nanobench::Bench& bench, std::string const& name, Pipeline const& pipeline, double const nullRatio)
+    {
+        gimo::BitmapColumn<T> const column = make_column<T>(nullRatio);
+
+        std::string suffix{" - "};
+        suffix += name;
+        suffix += " - ";
+        suffix += std::to_string(static_cast<int>(nullRatio * 100.0));
+        suffix += "% null - ";
+        suffix += instruction_set();
+
+        bench.batch(columnSize)
+            .run(
+                "gimo::apply_each" + suffix,
+                [&] {
+                    auto result = gimo::apply_each(column, pipeline);
+                    ankerl::nanobench::doNotOptimizeAway(result);
+                });
+
+        bench.batch(columnSize)
+            .run(
+                "gimo::apply_each(vectorized)" + suffix,
+                [&] {
+                    auto result = gimo::apply_each(gimo::vectorized, column, pipeline);
+                    ankerl::nanobench::doNotOptimizeAway(result);
+                });
+    }
+}
+
+void gimo::benchmarks::vectorized_bitmap_column_suite()
+{
+    // Generic actions, which are applied on whole simd-registers.
+    static constexpr auto simdFloat = gimo::transform([](auto const x) { return x * 2.f; })
+                                    | gimo::transform([](auto const x) { return x + 1.f; })
+                                    | gimo::value_or(0.f);
+    static constexpr auto simdInt = gimo::transform([](auto const x) { return x * 3; })
+                                  | gimo::value_or(-1);
+
+    // Actions, which only accept single values, thus are executed by the branchless scalar loop.
+    static constexpr auto scalarFloat = gimo::transform([](float const x) { return x * 2.f; })
+                                      | gimo::transform([](float const x) { return x + 1.f; })
+                                      | gimo::value_or(0.f);
+
+    auto bench = make_bench("vectorized bitmap column");
+
+    for (double const nullRatio : {0.0, 0.1, 0.5})
+    {
+        run<float>(bench, "float simd-actions", simdFloat, nullRatio);
+        run<int>(bench, "int simd-actions", simdInt, nullRatio);
+        run<float>(bench, "float scalar-actions", scalarFloat, nullRatio);
+    }
+
+    report(bench, "vectorized_bitmap_column");
+}
@@ -3,72 +3,43 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-#include "gimo/Pipeline.hpp"
-#include "gimo/algorithm/AndThen.hpp"
-#include "gimo_ext/StdOptional.hpp"
-
 #define ANKERL_NANOBENCH_IMPLEMENT
-#include <nanobench.h>
-
-namespace
+#include "Commons.hpp"
+
+/*
+ * Usage: gimo-benchmarks [output-directory]
+ *
+ * When an output-directory is given, the results of each suite are additionally written as `<suite>.json` and `<suite>.csv`.
+ */
+int main(int const argc, char const* const* const argv)
 {
-    auto make_setup(std::string prefix, unsigned const seed)
+    if (1 < argc)
     {
-        std::optional<int> opt =
-            seed % 2 == 0 ? std::nullopt : std::optional<int>{1337};
-        prefix += " - with ";
-        prefix += !opt
-                    ? "nullopt"
-                    : "optional{1337}";
-
-        return std::make_tuple(std::move(opt), std::move(prefix));
+        gimo::benchmarks::settings().outputDirectory = argv[1];
     }
 
-    void StdOptionalAndThenChain(ankerl::nanobench::Bench& bench, unsigned const seed)
-    {
-        auto const [opt, name] = make_setup("std::optional::and_then", seed);
-
-        bench.run(
-            name.data(),
-            [&] {
-                auto r = opt.and_then([](auto const& x) { return std::optional{static_cast<float>(x) + 1}; })
-                             .and_then([](float const x) { return std::optional{static_cast<short>(x) + 1}; })
-                             .and_then([](short const x) { return std::optional{static_cast<float>(x) + 1}; });
-
-                ankerl::nanobench::doNotOptimizeAway(r);
-            });
-    }
-
-    void GimoAndThenChain(ankerl::nanobench::Bench& bench, unsigned const seed)
-    {
-        auto const [opt, name] = make_setup("gimo::and_then", seed);
-
-        bench.run(
-            name.data(),
-            [&] {
-                auto const r = gimo::apply(
-                    opt,
-                    gimo::and_then([](auto const& x) { return std::optional{static_cast<float>(x) + 1}; })
-                        | gimo::and_then([](float const x) { return std::optional{static_cast<short>(x) + 1}; })
-                        | gimo::and_then([](short const x) { return std::optional{static_cast<float>(x) + 1}; }));
-
-                ankerl::nanobench::doNotOptimizeAway(r);
-            });
-    }
-}
-
-int main()
-{
-    [[maybe_unused]] auto const seed = std::random_device{}();
-
-    ankerl::nanobench::Bench bench{};
-    bench.relative(true)
-        .warmup(1000)
-        .minEpochIterations(100'000'000)
-        .performanceCounters(true);
-
-    StdOptionalAndThenChain(bench, 1);
-    GimoAndThenChain(bench, 1);
-    StdOptionalAndThenChain(bench, 2);
-    GimoAndThenChain(bench, 2);
+    gimo::benchmarks::and_then_suite();
+    gimo::benchmarks::transform_suite();
+    gimo::benchmarks::or_else_suite();
+    gimo::benchmarks::transform_error_suite();
+    gimo::benchmarks::value_or_suite();
+    gimo::benchmarks::value_or_else_suite();
+    gimo::benchmarks::null_distribution_suite();
+    gimo::benchmarks::batch_suite();
+    gimo::benchmarks::bitmap_column_suite();
+    gimo::benchmarks::vectorized_bitmap_column_suite();
+    gimo::benchmarks::parallel_batch_suite();
+    gimo::benchmarks::partition_suite();
+    gimo::benchmarks::pointer_transform_suite();
+    gimo::benchmarks::arena_suite();
+    gimo::benchmarks::compact_optional_suite();
+    gimo::benchmarks::tagged_pointer_suite();
+    gimo::benchmarks::compact_expected_suite();
+    gimo::benchmarks::noexcept_suite();
+    gimo::benchmarks::any_pipeline_suite();
+    gimo::benchmarks::runtime_pipeline_suite();
+    gimo::benchmarks::coroutine_suite();
+    gimo::benchmarks::and_then_async_suite();
+    gimo::benchmarks::lazy_suite();
+    gimo::benchmarks::tracing_suite();
 }
@@ -23,7 +23,7 @@ configure_package_config_file(
 )
 
 install(
-	TARGETS						gimo
+	TARGETS						gimo gimo-parallel
 	EXPORT						gimo-targets
 	PUBLIC_HEADER DESTINATION	"${GIMO_INCLUDE_INSTALL_DIR}"
 )
@@ -12,6 +12,7 @@
 
 #include "gimo/Common.hpp"
 #include "gimo/Pipeline.hpp"
+#include "gimo/Batch.hpp"
 
 #include "gimo/algorithm/BasicAlgorithm.hpp"
 
@@ -0,0 +1,300 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_ANY_PIPELINE_HPP
+#define GIMO_ANY_PIPELINE_HPP
+
+#pragma once
+
+#include "gimo/Config.hpp"
+#include "gimo/Pipeline.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    /**
+     * \brief The default number of bytes, which `BasicAnyPipeline` provides for storing pipelines in-place.
+     */
+    inline constexpr std::size_t anyPipelineBufferSize{3u * sizeof(void*)};
+
+    namespace detail::any_pipeline
+    {
+        template <typename In, typename Out>
+        struct VTable
+        {
+            Out (*apply)(void const* storage, In&& input);
+            void (*copy)(void* target, void const* source);
+            void (*relocate)(void* target, void* source) noexcept;
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template <typename In, typename Pipeline>
+        using result_t = decltype(std::declval<Pipeline const&>().apply(std::declval<In>()));
+
+        template <typename Pipeline, typename In, typename Out, bool isCopyable>
+        concept storable = pipeline<Pipeline>
+                        && processable_by<In, Pipeline const&>
+                        && std::convertible_to<result_t<In, Pipeline>, Out>
+                        && (!isCopyable || std::copy_constructible<Pipeline>);
+
+        template <typename Pipeline, std::size_t bufferSize>
+        concept stored_in_place = sizeof(Pipeline) <= bufferSize
+                               && alignof(Pipeline) <= alignof(std::max_align_t)
+                               && std::is_nothrow_move_constructible_v<Pipeline>;
+
+        template <typename Pipeline, bool inPlace>
+        struct Handler;
+
+        template <typename Pipeline>
+        struct Handler<Pipeline, true>
+        {
+            [[nodiscard]]
+            static Pipeline const& get(void const* const storage) noexcept
+            {
+                return *std::launder(static_cast<Pipeline const*>(storage));
+            }
+
+            template <typename... Args>
+            static void create(void* const storage, Args&&... args)
+            {
+                std::construct_at(static_cast<Pipeline*>(storage), std::forward<Args>(args)...);
+            }
+
+            static void copy(void* const target, void const* const source)
+            {
+                create(target, get(source));
+            }
+
+            static void relocate(void* const target, void* const source) noexcept
+            {
+                auto& pipeline = *std::launder(static_cast<Pipeline*>(source));
+                create(target, std::move(pipeline));
+                std::destroy_at(std::addressof(pipeline));
+            }
+
+            static void destroy(void* const storage) noexcept
+            {
+                std::destroy_at(std::launder(static_cast<Pipeline*>(storage)));
+            }
+        };
+
+        template <typename Pipeline>
+        struct Handler<Pipeline, false>
+        {
+            [[nodiscard]]
+            static Pipeline* pointer(void const* const storage) noexcept
+            {
+                return *std::launder(static_cast<Pipeline* const*>(storage));
+            }
+
+            [[nodiscard]]
+            static Pipeline const& get(void const* const storage) noexcept
+            {
+                return *pointer(storage);
+            }
+
+            template <typename... Args>
+            static void create(void* const storage, Args&&... args)
+            {
+                std::construct_at(static_cast<Pipeline**>(storage), new Pipeline(std::forward<Args>(args)...));
+            }
+
+            static void copy(void* const target, void const* const source)
+            {
+                create(target, get(source));
+            }
+
+            static void relocate(void* const target, void* const source) noexcept
+            {
+                std::construct_at(static_cast<Pipeline**>(target), pointer(source));
+            }
+
+            static void destroy(void* const storage) noexcept
+            {
+                delete pointer(storage);
+            }
+        };
+
+        template <typename In, typename Out, typename Handler>
+        [[nodiscard]]
+        Out apply(void const* const storage, In&& input)
+        {
+            return Handler::get(storage).apply(std::forward<In>(input));
+        }
+
+        template <typename In, typename Out, typename Pipeline, std::size_t bufferSize, bool isCopyable>
+        inline constexpr auto vTable = [] {
+            using handler = Handler<Pipeline, stored_in_place<Pipeline, bufferSize>>;
+
+            VTable<In, Out> table{
+                .apply = &any_pipeline::apply<In, Out, handler>,
+                .copy = nullptr,
+                .relocate = &handler::relocate,
+                .destroy = &handler::destroy};
+            if constexpr (isCopyable)
+            {
+                table.copy = &handler::copy;
+            }
+
+            return table;
+        }();
+    }
+
+    /**
+     * \brief A type-erased wrapper around a whole `Pipeline`, which accepts `In` and returns `Out`.
+     * \tparam In The input type. May be a reference type, e.g. `std::optional<int> const&`.
+     * \tparam Out The result type.
+     * \tparam isCopyable Determines, whether the wrapper (and thus each stored pipeline) must be copyable.
+     * \tparam bufferSize The number of bytes, which are available for the in-place storage.
+     * \details
+     * Pipelines, which fit into the buffer and are nothrow move-constructible, are stored in-place; others are allocated on the heap.
+     * Independent of the number of steps, each `apply` performs exactly one indirect call.
+     *
+     * A default-constructed or moved-from wrapper is empty and must not be applied.
+     */
+    template <typename In, typename Out, bool isCopyable, std::size_t bufferSize = anyPipelineBufferSize>
+        requires(sizeof(void*) <= bufferSize)
+    class BasicAnyPipeline
+    {
+    public:
+        using input_type = In;
+        using result_type = Out;
+
+        /**
+         * \brief Creates an empty wrapper.
+         */
+        [[nodiscard]]
+        BasicAnyPipeline() = default;
+
+        /**
+         * \brief Stores the given pipeline.
+         * \tparam Pipeline The pipeline type.
+         * \param steps The pipeline to store.
+         */
+        template <typename Pipeline>
+            requires detail::any_pipeline::storable<std::remove_cvref_t<Pipeline>, In, Out, isCopyable>
+        [[nodiscard]]
+        explicit(false) BasicAnyPipeline(Pipeline&& steps)
+            : m_VTable{&detail::any_pipeline::vTable<In, Out, std::remove_cvref_t<Pipeline>, bufferSize, isCopyable>}
+        {
+            using stored = std::remove_cvref_t<Pipeline>;
+            using handler = detail::any_pipeline::Handler<stored, detail::any_pipeline::stored_in_place<stored, bufferSize>>;
+
+            handler::create(m_Storage, std::forward<Pipeline>(steps));
+        }
+
+        ~BasicAnyPipeline() noexcept
+        {
+            reset();
+        }
+
+        [[nodiscard]]
+        BasicAnyPipeline(BasicAnyPipeline const& other)
+            requires isCopyable
+            : m_VTable{other.m_VTable}
+        {
+            if (m_VTable)
+            {
+                m_VTable->copy(m_Storage, other.m_Storage);
+            }
+        }
+
+        BasicAnyPipeline& operator=(BasicAnyPipeline const& other)
+            requires isCopyable
+        {
+            if (this != std::addressof(other))
+            {
+                BasicAnyPipeline copy{other};
+                *this = std::move(copy);
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]]
+        BasicAnyPipeline(BasicAnyPipeline&& other) noexcept
+            : m_VTable{std::exchange(other.m_VTable, nullptr)}
+        {
+            if (m_VTable)
+            {
+                m_VTable->relocate(m_Storage, other.m_Storage);
+            }
+        }
+
+        BasicAnyPipeline& operator=(BasicAnyPipeline&& other) noexcept
+        {
+            if (this != std::addressof(other))
+            {
+                reset();
+                m_VTable = std::exchange(other.m_VTable, nullptr);
+                if (m_VTable)
+                {
+                    m_VTable->relocate(m_Storage, other.m_Storage);
+                }
+            }
+
+            return *this;
+        }
+
+        /**
+         * \brief Determines, whether a pipeline is stored.
+         */
+        [[nodiscard]]
+        explicit operator bool() const noexcept
+        {
+            return nullptr != m_VTable;
+        }
+
+        /**
+         * \brief Applies the input on the stored pipeline.
+         * \param input The input value to process.
+         * \return The result of the pipeline execution.
+         */
+        Out apply(In input) const
+        {
+            GIMO_ASSERT(m_VTable, "AnyPipeline must not be empty.");
+
+            return m_VTable->apply(m_Storage, std::forward<In>(input));
+        }
+
+    private:
+        detail::any_pipeline::VTable<In, Out> const* m_VTable{};
+        alignas(std::max_align_t) std::byte m_Storage[bufferSize];
+
+        void reset() noexcept
+        {
+            if (auto const* const table = std::exchange(m_VTable, nullptr))
+            {
+                table->destroy(m_Storage);
+            }
+        }
+    };
+
+    /**
+     * \brief A copyable type-erased pipeline.
+     * \tparam In The input type.
+     * \tparam Out The result type.
+     * \tparam bufferSize The number of bytes, which are available for the in-place storage.
+     */
+    template <typename In, typename Out, std::size_t bufferSize = anyPipelineBufferSize>
+    using AnyPipeline = BasicAnyPipeline<In, Out, true, bufferSize>;
+
+    /**
+     * \brief A move-only type-erased pipeline, which may also store move-only pipelines.
+     * \tparam In The input type.
+     * \tparam Out The result type.
+     * \tparam bufferSize The number of bytes, which are available for the in-place storage.
+     */
+    template <typename In, typename Out, std::size_t bufferSize = anyPipelineBufferSize>
+    using MoveOnlyAnyPipeline = BasicAnyPipeline<In, Out, false, bufferSize>;
+}
+
+#endif
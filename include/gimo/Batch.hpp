@@ -0,0 +1,305 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_BATCH_HPP
+#define GIMO_BATCH_HPP
+
+#pragma once
+
+#include "gimo/Pipeline.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    namespace detail
+    {
+        template <typename Nullable, typename Pipeline>
+        using apply_result_t = decltype(std::declval<Pipeline const&>().apply(std::declval<Nullable>()));
+
+        /**
+         * \brief Provides the pipeline, which is applied on each element.
+         * \details
+         * Trivially copyable pipelines are copied into a local object, so that the compiler can prove that writes
+         * through the output-iterator never alias any of the actions, and thus may keep them in registers.
+         */
+        template <typename Pipeline>
+        [[nodiscard]]
+        constexpr decltype(auto) hoist_pipeline(Pipeline const& pipeline) noexcept(std::is_trivially_copyable_v<Pipeline>)
+        {
+            if constexpr (std::is_trivially_copyable_v<Pipeline>)
+            {
+                return Pipeline{pipeline};
+            }
+            else
+            {
+                return (pipeline);
+            }
+        }
+    }
+
+    /**
+     * \brief Applies each element of the input-range on the pipeline and writes the results into the output.
+     * \tparam Range The input-range type.
+     * \tparam Pipeline The pipeline type.
+     * \tparam Out The output-iterator type.
+     * \param range The elements to process.
+     * \param pipeline The pipeline to execute for each element.
+     * \param out The beginning of the destination.
+     * \return The end of the input-range and the output-iterator past the last written element.
+     * \details
+     * This is semantically equivalent to `std::ranges::transform(range, out, [&](auto&& e) { return pipeline.apply(e); })`,
+     * but keeps the whole loop visible to the compiler.
+     * When both, input and output, are contiguous, the elements are processed by a plain counted loop,
+     * which the compiler can unroll or vectorize.
+     *
+     * The pipeline is never consumed, as it's applied multiple times.
+     * No allocations are done by this function itself.
+     */
+    template <std::ranges::input_range Range, pipeline Pipeline, std::weakly_incrementable Out>
+        requires processable_by<std::ranges::range_reference_t<Range>, Pipeline const&>
+              && std::indirectly_writable<Out, detail::apply_result_t<std::ranges::range_reference_t<Range>, Pipeline>>
+    constexpr std::ranges::in_out_result<std::ranges::borrowed_iterator_t<Range>, Out> apply_each(
+        Range&& range,
+        Pipeline const& pipeline,
+        Out out)
+    {
+        // Bound as const, so that the `const&` overload of `apply` is used, which the constraints check for.
+        auto const& steps = detail::hoist_pipeline(pipeline);
+
+        if constexpr (std::ranges::contiguous_range<Range>
+                      && std::ranges::sized_range<Range>
+                      && std::contiguous_iterator<Out>)
+        {
+            auto const count = static_cast<std::size_t>(std::ranges::size(range));
+            auto* const input = std::ranges::data(range);
+            auto* const output = std::to_address(out);
+            for (std::size_t i{0u}; i < count; ++i)
+            {
+                output[i] = steps.apply(input[i]);
+            }
+
+            return {
+                std::ranges::next(std::ranges::begin(range), std::ranges::end(range)),
+                std::move(out) + static_cast<std::iter_difference_t<Out>>(count)};
+        }
+        else
+        {
+            auto iter = std::ranges::begin(range);
+            auto const end = std::ranges::end(range);
+            for (; iter != end; ++iter, ++out)
+            {
+                *out = steps.apply(*iter);
+            }
+
+            return {std::move(iter), std::move(out)};
+        }
+    }
+
+    namespace detail
+    {
+        /**
+         * \brief Applies each element on the pipeline, writes the values into `values` and hands all other results to `onNull`.
+         * \return The end of the input-range.
+         */
+        template <typename Result, typename Range, typename Pipeline, typename ValueOut, typename OnNull>
+        constexpr std::ranges::iterator_t<Range> partition_results(
+            Range& range,
+            Pipeline const& pipeline,
+            ValueOut& values,
+            std::size_t& valueCount,
+            OnNull&& onNull)
+        {
+            auto const& steps = detail::hoist_pipeline(pipeline);
+
+            auto iter = std::ranges::begin(range);
+            for (auto const end = std::ranges::end(range); iter != end; ++iter)
+            {
+                Result result = steps.apply(*iter);
+                if (detail::has_value(result))
+                {
+                    *values = detail::forward_value<Result>(result);
+                    ++values;
+                    ++valueCount;
+                }
+                else
+                {
+                    std::invoke(onNull, result);
+                }
+            }
+
+            return iter;
+        }
+    }
+
+    /**
+     * \brief The result of `partition_each`.
+     * \tparam In The input-iterator type.
+     * \tparam ValueOut The output-iterator type of the values.
+     * \tparam ErrorOut The output-iterator type of the errors.
+     */
+    template <typename In, typename ValueOut, typename ErrorOut>
+    struct PartitionResult
+    {
+        /**
+         * \brief The end of the input-range.
+         */
+        In in;
+
+        /**
+         * \brief The value-iterator past the last written value.
+         */
+        ValueOut values;
+
+        /**
+         * \brief The error-iterator past the last written error.
+         */
+        ErrorOut errors;
+
+        /**
+         * \brief The number of written values.
+         */
+        std::size_t valueCount{};
+
+        /**
+         * \brief The number of written errors.
+         */
+        std::size_t errorCount{};
+    };
+
+    /**
+     * \brief Applies each element of the input-range on the pipeline and partitions the results into values and errors.
+     * \tparam Range The input-range type.
+     * \tparam Pipeline The pipeline type.
+     * \tparam ValueOut The output-iterator type of the values.
+     * \tparam ErrorOut The output-iterator type of the errors.
+     * \param range The elements to process.
+     * \param pipeline The pipeline to execute for each element. Must yield an `expected_like` type.
+     * \param values The beginning of the value-destination.
+     * \param errors The beginning of the error-destination.
+     * \return The end of the input-range, the end of both destinations and the number of values and errors.
+     * \details
+     * This is done in a single pass, without any intermediate storage of the pipeline results.
+     * The values and errors are moved out of the results, preserving their relative order.
+     * As the counts are reported, they may be used to pre-size the destinations of subsequent batches.
+     */
+    template <
+        std::ranges::input_range Range,
+        pipeline Pipeline,
+        std::weakly_incrementable ValueOut,
+        std::weakly_incrementable ErrorOut,
+        typename Result = detail::apply_result_t<std::ranges::range_reference_t<Range>, Pipeline>>
+        requires processable_by<std::ranges::range_reference_t<Range>, Pipeline const&>
+              && expected_like<Result>
+              && std::indirectly_writable<ValueOut, detail::value_result_t<Result>>
+              && std::indirectly_writable<ErrorOut, detail::error_result_t<Result>>
+    constexpr PartitionResult<std::ranges::borrowed_iterator_t<Range>, ValueOut, ErrorOut> partition_each(
+        Range&& range,
+        Pipeline const& pipeline,
+        ValueOut values,
+        ErrorOut errors)
+    {
+        std::size_t valueCount{0u};
+        std::size_t errorCount{0u};
+        auto iter = detail::partition_results<Result>(
+            range,
+            pipeline,
+            values,
+            valueCount,
+            [&](Result& result) {
+                *errors = detail::forward_error<Result>(result);
+                ++errors;
+                ++errorCount;
+            });
+
+        return {
+            .in = std::move(iter),
+            .values = std::move(values),
+            .errors = std::move(errors),
+            .valueCount = valueCount,
+            .errorCount = errorCount};
+    }
+
+    /**
+     * \brief The result of `partition_each` for pipelines, which yield a nullable without an error.
+     * \tparam In The input-iterator type.
+     * \tparam ValueOut The output-iterator type of the values.
+     */
+    template <typename In, typename ValueOut>
+    struct NullPartitionResult
+    {
+        /**
+         * \brief The end of the input-range.
+         */
+        In in;
+
+        /**
+         * \brief The value-iterator past the last written value.
+         */
+        ValueOut values;
+
+        /**
+         * \brief The number of written values.
+         */
+        std::size_t valueCount{};
+
+        /**
+         * \brief The number of null results.
+         */
+        std::size_t nullCount{};
+    };
+
+    /**
+     * \brief Applies each element of the input-range on the pipeline and writes the values of the results into the output.
+     * \tparam Range The input-range type.
+     * \tparam Pipeline The pipeline type.
+     * \tparam ValueOut The output-iterator type of the values.
+     * \param range The elements to process.
+     * \param pipeline The pipeline to execute for each element. Must yield a `nullable`, which is not `expected_like`.
+     * \param values The beginning of the value-destination.
+     * \return The end of the input-range, the end of the destination and the number of values and nulls.
+     * \details
+     * This is the counterpart of the error-partitioning overload for optional-like results.
+     * As nulls do not carry any information, they are merely counted.
+     */
+    template <
+        std::ranges::input_range Range,
+        pipeline Pipeline,
+        std::weakly_incrementable ValueOut,
+        typename Result = detail::apply_result_t<std::ranges::range_reference_t<Range>, Pipeline>>
+        requires processable_by<std::ranges::range_reference_t<Range>, Pipeline const&>
+              && nullable<Result>
+              && (!expected_like<Result>)
+              && std::indirectly_writable<ValueOut, detail::value_result_t<Result>>
+    constexpr NullPartitionResult<std::ranges::borrowed_iterator_t<Range>, ValueOut> partition_each(
+        Range&& range,
+        Pipeline const& pipeline,
+        ValueOut values)
+    {
+        std::size_t valueCount{0u};
+        std::size_t nullCount{0u};
+        auto iter = detail::partition_results<Result>(
+            range,
+            pipeline,
+            values,
+            valueCount,
+            [&]([[maybe_unused]] Result& result) noexcept { ++nullCount; });
+
+        return {
+            .in = std::move(iter),
+            .values = std::move(values),
+            .valueCount = valueCount,
+            .nullCount = nullCount};
+    }
+}
+
+#endif
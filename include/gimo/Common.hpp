@@ -97,6 +97,17 @@ namespace gimo
      * \tparam Nullable The type to be adapted.
      * \details
      * To adapt a custom type for use with the monadic algorithms, you must specialize this struct.
+     *
+     * Types, which are guaranteed to never be null when entering a pipeline step, may opt in to skip the emptiness-check
+     * by declaring `static constexpr bool always_engaged{true};`.
+     *
+     * Types, which exclusively own their value, may declare `static constexpr bool owns_value(Nullable const&)`.
+     * When it returns `true` for an rvalue input, `transform` assigns the result of a type-preserving action
+     * to the existing value, instead of constructing a new nullable.
+     *
+     * Types, which allocate their value, may declare `template <typename V> static rebind_value<V> from_value_like(Nullable const&, Arg&&)`.
+     * Rebinding operations (e.g. `transform`) then construct the new nullable with the allocation resources
+     * (e.g. allocator, deleter or memory-resource) of the source, instead of the default ones.
      */
     template <typename Nullable>
     struct traits;
@@ -147,6 +158,7 @@ namespace gimo
 
         template <trait_readable_value T>
         constexpr decltype(auto) value_impl([[maybe_unused]] priority_tag<2u> const tag, T&& closure)
+            noexcept(noexcept(traits<std::remove_cvref_t<T>>::value(std::forward<T>(closure))))
         {
             return traits<std::remove_cvref_t<T>>::value(std::forward<T>(closure));
         }
@@ -158,6 +170,7 @@ namespace gimo
 
         template <indirectly_readable_value T>
         constexpr decltype(auto) value_impl([[maybe_unused]] priority_tag<1u> const tag, T&& closure)
+            noexcept(noexcept(*std::forward<T>(closure)))
         {
             return *std::forward<T>(closure);
         }
@@ -169,6 +182,7 @@ namespace gimo
 
         template <adl_readable_value T>
         constexpr decltype(auto) value_impl([[maybe_unused]] priority_tag<0u> const tag, T&& closure)
+            noexcept(noexcept(value(std::forward<T>(closure))))
         {
             return value(std::forward<T>(closure));
         }
@@ -182,6 +196,7 @@ namespace gimo
 
         template <readable_value T>
         constexpr decltype(auto) value(T&& closure)
+            noexcept(noexcept(detail::value_impl(max_value_tag, std::forward<T>(closure))))
         {
             return detail::value_impl(max_value_tag, std::forward<T>(closure));
         }
@@ -279,6 +294,59 @@ namespace gimo
     template <nullable Nullable, typename Value>
     using rebind_value_t = typename traits<std::remove_cvref_t<Nullable>>::template rebind_value<Value>;
 
+    namespace detail
+    {
+        template <typename Source, typename Value, typename Arg>
+        concept trait_value_constructible_like = requires(Source const& source, Arg&& arg) {
+            { traits<std::remove_cvref_t<Source>>::template from_value_like<Value>(source, std::forward<Arg>(arg)) }
+                -> std::same_as<rebind_value_t<Source, Value>>;
+        };
+
+        template <typename Value, typename Source, typename Arg>
+        consteval bool is_nothrow_constructible_from_value_like()
+        {
+            if constexpr (trait_value_constructible_like<Source, Value, Arg>)
+            {
+                return noexcept(traits<std::remove_cvref_t<Source>>::template from_value_like<Value>(
+                    std::declval<Source const&>(),
+                    std::declval<Arg>()));
+            }
+            else
+            {
+                return nothrow_constructible_from_value<rebind_value_t<Source, Value>, Arg>;
+            }
+        }
+    }
+
+    /**
+     * \brief Constructs the `Source` type, rebound to `Value`, with the provided value.
+     * \tparam Value The new value-type to rebind to.
+     * \tparam Source The source-nullable type.
+     * \tparam Arg The construction argument type to forward.
+     * \param source The nullable, whose allocation resources shall be propagated.
+     * \param arg The argument forwarded to the actual construction strategy.
+     * \return A newly created nullable instance in a non-null state.
+     * \note The exception specification matches the underlying construction strategy.
+     * \details
+     * The construction strategy is selected based on the following precedence:
+     * - **Priority 1:** `gimo::traits<Source>::from_value_like<Value>`
+     * - **Priority 2:** `gimo::construct_from_value`
+     */
+    template <typename Value, nullable Source, typename Arg>
+        requires constructible_from_value<rebind_value_t<Source, Value>, Arg&&>
+    constexpr rebind_value_t<Source, Value> construct_from_value_like(Source const& source, Arg&& arg)
+        noexcept(detail::is_nothrow_constructible_from_value_like<Value, Source, Arg&&>())
+    {
+        if constexpr (detail::trait_value_constructible_like<Source, Value, Arg&&>)
+        {
+            return traits<std::remove_cvref_t<Source>>::template from_value_like<Value>(source, std::forward<Arg>(arg));
+        }
+        else
+        {
+            return construct_from_value<rebind_value_t<Source, Value>>(std::forward<Arg>(arg));
+        }
+    }
+
     /**
      * \brief Concept determining whether the `Nullable` type supports rebinding its value-type.
      * \tparam Nullable The source-nullable type to adapt the new value-type.
@@ -304,15 +372,35 @@ namespace gimo
         template <nullable Nullable>
         using value_result_t = decltype(value(std::declval<Nullable&&>()));
 
+        template <typename Nullable>
+        concept always_engaged = requires {
+            requires traits<std::remove_cvref_t<Nullable>>::always_engaged;
+        };
+
+        template <typename Nullable>
+        concept value_owning = requires(Nullable const& target) {
+            { traits<std::remove_cvref_t<Nullable>>::owns_value(target) } -> boolean_testable;
+        };
+
+        template <value_owning Nullable>
+        [[nodiscard]]
+        constexpr bool owns_value(Nullable const& target)
+            noexcept(noexcept(static_cast<bool>(traits<std::remove_cvref_t<Nullable>>::owns_value(target))))
+        {
+            return static_cast<bool>(traits<std::remove_cvref_t<Nullable>>::owns_value(target));
+        }
+
         template <typename Nullable>
         [[nodiscard]]
         constexpr bool has_value(Nullable const& target)
+            noexcept(noexcept(static_cast<bool>(target != null_v<Nullable>)))
         {
             return target != null_v<Nullable>;
         }
 
         template <nullable T>
         constexpr decltype(auto) forward_value(std::remove_reference_t<T>& nullable)
+            noexcept(noexcept(detail::value(std::forward<T>(nullable))))
         {
             GIMO_ASSERT(detail::has_value(nullable), "Nullable must contain a value.", nullable);
 
@@ -322,6 +410,7 @@ namespace gimo
         template <nullable Nullable>
         [[nodiscard]]
         constexpr auto construct_empty()
+            noexcept(noexcept(Nullable{null_v<Nullable>}))
         {
             return Nullable{null_v<Nullable>};
         }
@@ -329,6 +418,7 @@ namespace gimo
         template <nullable Nullable, nullable Source>
         [[nodiscard]]
         constexpr Nullable rebind_value(std::remove_reference_t<Source>& source)
+            noexcept(noexcept(construct_from_value<Nullable>(forward_value<Source>(source))))
         {
             return construct_from_value<Nullable>(forward_value<Source>(source));
         }
@@ -343,6 +433,7 @@ namespace gimo
 
         template <trait_readable_error T>
         constexpr decltype(auto) error_impl([[maybe_unused]] priority_tag<2u> const tag, T&& closure)
+            noexcept(noexcept(traits<std::remove_cvref_t<T>>::error(std::forward<T>(closure))))
         {
             return traits<std::remove_cvref_t<T>>::error(std::forward<T>(closure));
         }
@@ -354,6 +445,7 @@ namespace gimo
 
         template <member_readable_error T>
         constexpr decltype(auto) error_impl([[maybe_unused]] priority_tag<1u> const tag, T&& closure)
+            noexcept(noexcept(std::forward<T>(closure).error()))
         {
             return std::forward<T>(closure).error();
         }
@@ -365,6 +457,7 @@ namespace gimo
 
         template <adl_readable_error T>
         constexpr decltype(auto) error_impl([[maybe_unused]] priority_tag<0u> const tag, T&& closure)
+            noexcept(noexcept(error(std::forward<T>(closure))))
         {
             return error(std::forward<T>(closure));
         }
@@ -378,6 +471,7 @@ namespace gimo
 
         template <readable_error T>
         constexpr decltype(auto) error(T&& closure)
+            noexcept(noexcept(detail::error_impl(max_error_tag, std::forward<T>(closure))))
         {
             return detail::error_impl(max_error_tag, std::forward<T>(closure));
         }
@@ -435,6 +529,7 @@ namespace gimo
 
         template <expected_like T>
         constexpr decltype(auto) forward_error(std::remove_reference_t<T>& expected)
+            noexcept(noexcept(detail::error(std::forward<T>(expected))))
         {
             GIMO_ASSERT(!detail::has_value(expected), "Expected must hold an error.", expected);
 
@@ -443,6 +538,7 @@ namespace gimo
 
         template <expected_like Expected, typename Error>
         constexpr Expected construct_from_error(Error&& error)
+            noexcept(noexcept(traits<Expected>::from_error(std::forward<Error>(error))))
         {
             return traits<Expected>::from_error(std::forward<Error>(error));
         }
@@ -450,6 +546,7 @@ namespace gimo
         template <expected_like Expected, expected_like Source>
         [[nodiscard]]
         constexpr Expected rebind_error(std::remove_reference_t<Source>& source)
+            noexcept(noexcept(detail::construct_from_error<Expected>(forward_error<Source>(source))))
         {
             return detail::construct_from_error<Expected>(forward_error<Source>(source));
         }
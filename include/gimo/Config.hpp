@@ -11,4 +11,45 @@
     #define GIMO_ASSERT(condition, msg, ...) assert((condition) && msg)
 #endif
 
+/**
+ * \brief Allows empty members to overlap with other members.
+ * \details MSVC silently ignores the standard attribute and requires its own one instead.
+ */
+#ifndef GIMO_NO_UNIQUE_ADDRESS
+    #ifdef _MSC_VER
+        #define GIMO_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+    #else
+        #define GIMO_NO_UNIQUE_ADDRESS [[no_unique_address]]
+    #endif
+#endif
+
+/**
+ * \brief Enables the empty-base-optimization for each base of a class with multiple bases.
+ * \details MSVC applies it only to the first base otherwise.
+ */
+#ifndef GIMO_EMPTY_BASES
+    #ifdef _MSC_VER
+        #define GIMO_EMPTY_BASES __declspec(empty_bases)
+    #else
+        #define GIMO_EMPTY_BASES
+    #endif
+#endif
+
+/**
+ * \brief Determines, whether `gimo::instrumented` actually instruments the pipeline.
+ * \details When defined as `0`, `gimo::instrumented` returns the very same pipeline type it receives,
+ * which completely removes the instrumentation from the generated code.
+ */
+#ifndef GIMO_INSTRUMENT
+    #define GIMO_INSTRUMENT 1
+#endif
+
+/**
+ * \brief Determines, whether `gimo::traced` actually traces the pipeline.
+ * \details When defined as `0`, `gimo::traced` returns the very same pipeline type it receives.
+ */
+#ifndef GIMO_TRACE
+    #define GIMO_TRACE 1
+#endif
+
 #endif
@@ -0,0 +1,323 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_COROUTINE_HPP
+#define GIMO_COROUTINE_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    template <nullable Nullable>
+    class Coroutine;
+
+    namespace detail::coroutine
+    {
+        template <typename Awaited>
+        using resume_t = std::conditional_t<
+            std::is_lvalue_reference_v<Awaited>,
+            value_result_t<Awaited>,
+            std::remove_cvref_t<value_result_t<Awaited>>>;
+
+        /**
+         * \brief Recycles the most recently released coroutine frame of the current thread.
+         * \details
+         * Not every compiler elides the frame allocation of inlined coroutines.
+         * As coroutines are commonly created and destroyed in a loop, the cache makes the steady state allocation-free anyway.
+         */
+        class FrameCache
+        {
+        public:
+            [[nodiscard]]
+            static void* allocate(std::size_t const size)
+            {
+                if (Slot& slot = cached(); slot.block && size <= slot.size)
+                {
+                    return std::exchange(slot.block, nullptr);
+                }
+
+                return ::operator new(size);
+            }
+
+            static void deallocate(void* const block, std::size_t const size) noexcept
+            {
+                Slot& slot = cached();
+                if (slot.block && size <= slot.size)
+                {
+                    ::operator delete(block);
+                    return;
+                }
+
+                ::operator delete(std::exchange(slot.block, block));
+                slot.size = size;
+            }
+
+        private:
+            struct Slot
+            {
+                void* block{};
+                std::size_t size{};
+
+                ~Slot() noexcept
+                {
+                    ::operator delete(block);
+                }
+            };
+
+            [[nodiscard]]
+            static Slot& cached() noexcept
+            {
+                thread_local Slot slot{};
+
+                return slot;
+            }
+        };
+
+        template <typename Nullable>
+        class Promise
+        {
+        public:
+            [[nodiscard]]
+            static void* operator new(std::size_t const size)
+            {
+                return FrameCache::allocate(size);
+            }
+
+            static void operator delete(void* const frame, std::size_t const size) noexcept
+            {
+                FrameCache::deallocate(frame, size);
+            }
+
+            [[nodiscard]]
+            Coroutine<Nullable> get_return_object() noexcept
+            {
+                return Coroutine<Nullable>{std::coroutine_handle<Promise>::from_promise(*this)};
+            }
+
+            [[nodiscard]]
+            static constexpr std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            [[nodiscard]]
+            static constexpr std::suspend_always final_suspend() noexcept
+            {
+                return {};
+            }
+
+            template <typename Value>
+                requires constructible_from_value<Nullable, Value&&>
+            void return_value(Value&& value)
+            {
+                m_Result.emplace(construct_from_value<Nullable>(std::forward<Value>(value)));
+            }
+
+            void unhandled_exception() noexcept
+            {
+                m_Exception = std::current_exception();
+            }
+
+            template <nullable Awaited>
+            [[nodiscard]]
+            constexpr auto await_transform(Awaited&& awaited) noexcept;
+
+            /**
+             * \brief Stores the null-state (or error) of the awaited nullable as the final result.
+             * \details Errors are only propagated, when both, the awaited and the resulting type, are `expected_like`.
+             */
+            template <typename Source>
+            void short_circuit(std::remove_reference_t<Source>& source)
+            {
+                if constexpr (expected_like<Source> && expected_like<Nullable>)
+                {
+                    m_Result.emplace(detail::rebind_error<Nullable, Source>(source));
+                }
+                else
+                {
+                    m_Result.emplace(detail::construct_empty<Nullable>());
+                }
+            }
+
+            [[nodiscard]]
+            Nullable take_result()
+            {
+                if (m_Exception)
+                {
+                    std::rethrow_exception(m_Exception);
+                }
+
+                GIMO_ASSERT(m_Result, "Coroutine must be completed.");
+
+                return *std::move(m_Result);
+            }
+
+        private:
+            std::optional<Nullable> m_Result{};
+            std::exception_ptr m_Exception{};
+        };
+
+        template <typename Awaited, typename Nullable>
+        class Awaiter
+        {
+        public:
+            [[nodiscard]]
+            explicit constexpr Awaiter(std::remove_reference_t<Awaited>& awaited) noexcept
+                : m_Awaited{awaited}
+            {
+            }
+
+            [[nodiscard]]
+            constexpr bool await_ready() const
+                noexcept(always_engaged<Awaited> || noexcept(detail::has_value(std::declval<Awaited const&>())))
+            {
+                if constexpr (always_engaged<Awaited>)
+                {
+                    return true;
+                }
+                else
+                {
+                    return detail::has_value(m_Awaited);
+                }
+            }
+
+            void await_suspend(std::coroutine_handle<Promise<Nullable>> const handle)
+            {
+                handle.promise().template short_circuit<Awaited>(m_Awaited);
+            }
+
+            [[nodiscard]]
+            constexpr resume_t<Awaited> await_resume()
+                noexcept(noexcept(detail::forward_value<Awaited>(std::declval<std::remove_reference_t<Awaited>&>())))
+            {
+                return detail::forward_value<Awaited>(m_Awaited);
+            }
+
+        private:
+            std::remove_reference_t<Awaited>& m_Awaited;
+        };
+
+        template <typename Nullable>
+        template <nullable Awaited>
+        constexpr auto Promise<Nullable>::await_transform(Awaited&& awaited) noexcept
+        {
+            return Awaiter<Awaited, Nullable>{awaited};
+        }
+    }
+
+    /**
+     * \brief A coroutine return-type, which permits to `co_await` any `nullable`.
+     * \tparam Nullable The resulting nullable type.
+     * \details
+     * Awaiting a nullable either yields its value or immediately finishes the coroutine:
+     * - **On Value**: `co_await` unwraps the value. Lvalue operands yield a reference, rvalue operands their value.
+     * - **On Null**: The coroutine is not resumed and its result becomes null. When both, the awaited and the resulting type,
+     * are `expected_like`, the error is propagated instead.
+     *
+     * The coroutine runs eagerly and synchronously to its end (or to the first null), before the caller regains control.
+     * Awaiting anything else than a `nullable` is ill-formed.
+     *
+     * The coroutine frame is destroyed together with this object.
+     * As the handle never escapes, compilers are permitted to elide the frame allocation, when the coroutine is inlined.
+     * To benefit from that, the result should be obtained in the same expression as the call.
+     * Otherwise, the most recently released frame of the current thread is reused, if it's large enough.
+     * \code{.cpp}
+     * gimo::Coroutine<std::optional<int>> sum(std::optional<int> const& lhs, std::optional<int> const& rhs)
+     * {
+     *     co_return co_await lhs + co_await rhs;
+     * }
+     *
+     * std::optional<int> const result = sum(std::optional{1}, std::optional{2});
+     * \endcode
+     */
+    template <nullable Nullable>
+    class [[nodiscard]] Coroutine
+    {
+    public:
+        using promise_type = detail::coroutine::Promise<Nullable>;
+        using result_type = Nullable;
+
+        ~Coroutine() noexcept
+        {
+            if (m_Handle)
+            {
+                m_Handle.destroy();
+            }
+        }
+
+        Coroutine(Coroutine const&) = delete;
+        Coroutine& operator=(Coroutine const&) = delete;
+
+        [[nodiscard]]
+        Coroutine(Coroutine&& other) noexcept
+            : m_Handle{std::exchange(other.m_Handle, nullptr)}
+        {
+        }
+
+        Coroutine& operator=(Coroutine&& other) noexcept
+        {
+            if (this != std::addressof(other))
+            {
+                if (m_Handle)
+                {
+                    m_Handle.destroy();
+                }
+
+                m_Handle = std::exchange(other.m_Handle, nullptr);
+            }
+
+            return *this;
+        }
+
+        /**
+         * \brief Extracts the result of the coroutine.
+         * \return The `co_return`ed value, or the short-circuited null (or error).
+         * \throws Rethrows any exception, which escaped the coroutine body.
+         * \note Must be called at most once.
+         */
+        [[nodiscard]]
+        Nullable result() &&
+        {
+            GIMO_ASSERT(m_Handle, "Coroutine must not be moved-from.");
+
+            return m_Handle.promise().take_result();
+        }
+
+        /**
+         * \copydoc result
+         */
+        [[nodiscard]]
+        explicit(false) operator Nullable() &&
+        {
+            return std::move(*this).result();
+        }
+
+    private:
+        friend promise_type;
+
+        std::coroutine_handle<promise_type> m_Handle;
+
+        [[nodiscard]]
+        explicit Coroutine(std::coroutine_handle<promise_type> const handle) noexcept
+            : m_Handle{handle}
+        {
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,510 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_INSTRUMENTATION_HPP
+#define GIMO_INSTRUMENTATION_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/BasicAlgorithm.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gimo
+{
+    /**
+     * \brief Determines, whether the type can receive the events of an instrumented pipeline.
+     * \details
+     * The sink is notified with the zero-based index of the step, whenever that step is entered with a value (`on_value`)
+     * or with a null (`on_null`). Both notifications must not throw.
+     *
+     * If the sink additionally declares a `clock` type and an `on_duration(step, duration)` member-function,
+     * the time spent in each step is measured and reported, too.
+     * An optional `on_exit(step)` member-function is notified, once the step (and thus all of its successors) returned.
+     * Both, the duration and the exit, are also reported, when the step is left via an exception.
+     */
+    template <typename Sink>
+    concept instrumentation_sink = requires(Sink& sink, std::size_t const step) {
+        { sink.on_value(step) } noexcept;
+        { sink.on_null(step) } noexcept;
+    };
+}
+
+namespace gimo::detail::instrumentation
+{
+    template <typename Sink>
+    concept timed = requires(Sink& sink, std::size_t const step) {
+        typename Sink::clock;
+        { Sink::clock::now() } noexcept;
+        { sink.on_duration(step, typename Sink::clock::duration{}) } noexcept;
+    };
+
+    template <typename Sink>
+    concept exit_observing = requires(Sink& sink, std::size_t const step) {
+        { sink.on_exit(step) } noexcept;
+    };
+
+    /**
+     * \brief The action of an instrumented step, which wraps the original step as a whole.
+     * \details The index is part of the type, thus each probe merely stores the step and a pointer to the sink.
+     */
+    template <typename Step, typename Sink, std::size_t index>
+    struct Probe
+    {
+        using step_type = Step;
+        static constexpr std::size_t stepIndex{index};
+
+        [[nodiscard]]
+        explicit constexpr Probe(Step original, Sink& target) noexcept(std::is_nothrow_move_constructible_v<Step>)
+            : step{std::move(original)},
+              sink{std::addressof(target)}
+        {
+        }
+
+        GIMO_NO_UNIQUE_ADDRESS Step step;
+        Sink* sink;
+    };
+
+    template <typename Probe>
+    using probed_step_t = const_ref_like_t<Probe, typename std::remove_cvref_t<Probe>::step_type>;
+
+    template <typename Step, typename Nullable>
+    consteval bool is_nothrow_null_forwarding()
+    {
+        if constexpr (null_propagating<step_traits_t<Step>, Nullable, step_action_t<Step>>)
+        {
+            return is_nothrow_null_constructible_from<step_null_result_t<Step, Nullable>, Nullable>();
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    template <typename Sink>
+    struct start_time
+    {
+    };
+
+    template <timed Sink>
+    struct start_time<Sink>
+    {
+        typename Sink::clock::time_point value{Sink::clock::now()};
+    };
+
+    /**
+     * \brief Reports the duration and the exit of a step, once it's left; regardless whether it returns or throws.
+     */
+    template <std::size_t index, typename Sink>
+    class ExitGuard
+    {
+    public:
+        [[nodiscard]]
+        constexpr explicit ExitGuard(Sink& sink) noexcept
+            : m_Sink{&sink}
+        {
+        }
+
+        ExitGuard(ExitGuard const&) = delete;
+        ExitGuard& operator=(ExitGuard const&) = delete;
+
+        constexpr ~ExitGuard() noexcept
+        {
+            if constexpr (timed<Sink>)
+            {
+                m_Sink->on_duration(index, Sink::clock::now() - m_Start.value);
+            }
+
+            if constexpr (exit_observing<Sink>)
+            {
+                m_Sink->on_exit(index);
+            }
+        }
+
+    private:
+        Sink* m_Sink;
+        GIMO_NO_UNIQUE_ADDRESS start_time<Sink> m_Start{};
+    };
+
+    template <typename Probe, typename Fun>
+    [[nodiscard]]
+    constexpr auto measure(Probe const& probe, Fun&& fun)
+    {
+        using Sink = std::remove_pointer_t<decltype(probe.sink)>;
+
+        if constexpr (timed<Sink> || exit_observing<Sink>)
+        {
+            ExitGuard<Probe::stepIndex, Sink> const guard{*probe.sink};
+
+            return std::invoke(std::forward<Fun>(fun));
+        }
+        else
+        {
+            return std::invoke(std::forward<Fun>(fun));
+        }
+    }
+
+    /**
+     * \brief Reports each entered step to the sink and delegates the actual work to the original step.
+     * \details
+     * There is intentionally no `null_result_t`, as otherwise nulls would be fast-forwarded over the instrumented steps
+     * and thus remain uncounted.
+     * As each step enters its successor exactly once, the measured durations are inclusive of all subsequent steps.
+     */
+    struct traits
+    {
+        template <nullable Nullable, typename Probe>
+        using next_input_t = step_next_input_t<probed_step_t<Probe>, Nullable>;
+
+        template <nullable Nullable, typename Probe>
+        using result_t = typename step_traits_t<probed_step_t<Probe>>::template result_t<
+            Nullable,
+            step_action_t<probed_step_t<Probe>>>;
+
+        template <nullable Nullable, typename Probe>
+        static constexpr bool is_applicable_on = applicable_to<Nullable, probed_step_t<Probe>>;
+
+        template <nullable Nullable, typename Probe>
+        static constexpr bool is_nothrow_applicable_on = requires {
+            requires nothrow_applicable_to<Nullable, probed_step_t<Probe>>;
+            requires is_nothrow_null_forwarding<probed_step_t<Probe>, Nullable>();
+        };
+
+        template <typename Probe, nullable Nullable, typename... Steps>
+        [[nodiscard]]
+        static constexpr auto on_value(Probe&& probe, Nullable&& opt, Steps&&... steps)
+        {
+            probe.sink->on_value(std::remove_cvref_t<Probe>::stepIndex);
+
+            return instrumentation::measure(
+                probe,
+                [&] {
+                    return detail::forward_like<Probe>(probe.step)
+                        .on_value(std::forward<Nullable>(opt), std::forward<Steps>(steps)...);
+                });
+        }
+
+        template <typename Probe, nullable Nullable, typename... Steps>
+        [[nodiscard]]
+        static constexpr auto on_null(Probe&& probe, Nullable&& opt, Steps&&... steps)
+        {
+            probe.sink->on_null(std::remove_cvref_t<Probe>::stepIndex);
+
+            return instrumentation::measure(
+                probe,
+                [&] {
+                    return detail::forward_like<Probe>(probe.step)
+                        .on_null(std::forward<Nullable>(opt), std::forward<Steps>(steps)...);
+                });
+        }
+    };
+
+    template <typename Step, typename Sink, std::size_t index>
+    using instrumented_t = BasicAlgorithm<traits, Probe<std::remove_cvref_t<Step>, Sink, index>>;
+
+    template <typename Pipeline, typename Sink>
+    [[nodiscard]]
+    constexpr auto instrument(Pipeline&& steps, Sink& sink)
+    {
+        return pipeline_access::apply_steps(
+            std::forward<Pipeline>(steps),
+            [&]<typename... Steps>(Steps&&... originals) {
+                return [&]<std::size_t... indices>([[maybe_unused]] std::index_sequence<indices...> const tag) {
+                    using Instrumented = std::tuple<instrumented_t<Steps, Sink, indices>...>;
+
+                    return gimo::Pipeline{
+                        Instrumented{
+                            typename std::tuple_element_t<indices, Instrumented>::action_type{
+                                std::forward<Steps>(originals),
+                                sink}...}};
+                }(std::index_sequence_for<Steps...>{});
+            });
+    }
+
+    inline std::atomic<std::uint64_t> nextRegistryId{1u};
+
+    /**
+     * \brief Owns one `Block` per recording thread.
+     * \details
+     * Each thread caches the block it registered last, thus only the first access of a thread (or an access after
+     * switching between registries) requires the lock.
+     */
+    template <typename Block>
+    class PerThread
+    {
+    public:
+        /**
+         * \brief Returns the block of the calling thread; creates it via `factory` on the first call.
+         * \details A failing allocation terminates the program, as the recording threads must not throw.
+         */
+        template <typename Factory>
+        [[nodiscard]]
+        Block& local(Factory&& factory) noexcept
+        {
+            struct Cache
+            {
+                std::uint64_t registryId{};
+                Block* block{};
+            };
+
+            thread_local Cache cache{};
+            if (cache.registryId != m_Id) [[unlikely]]
+            {
+                cache = Cache{m_Id, &acquire(std::forward<Factory>(factory))};
+            }
+
+            return *cache.block;
+        }
+
+        /**
+         * \brief Invokes `fun` with the index and the block of each registered thread, in registration order.
+         */
+        template <typename Fun>
+        void for_each(Fun&& fun) const
+        {
+            std::scoped_lock const lock{m_Mutex};
+            for (std::size_t i{0u}; i < m_Entries.size(); ++i)
+            {
+                std::invoke(fun, i, std::as_const(*m_Entries[i].block));
+            }
+        }
+
+    private:
+        struct Entry
+        {
+            std::thread::id owner;
+            std::unique_ptr<Block> block;
+        };
+
+        std::uint64_t m_Id{nextRegistryId.fetch_add(1u, std::memory_order_relaxed)};
+        mutable std::mutex m_Mutex{};
+        std::vector<Entry> m_Entries{};
+
+        template <typename Factory>
+        [[nodiscard]]
+        Block& acquire(Factory&& factory)
+        {
+            std::thread::id const self = std::this_thread::get_id();
+
+            std::scoped_lock const lock{m_Mutex};
+            auto const iter = std::ranges::find(m_Entries, self, &Entry::owner);
+            if (iter != m_Entries.cend())
+            {
+                return *iter->block;
+            }
+
+            return *m_Entries.emplace_back(Entry{self, std::invoke(std::forward<Factory>(factory))}).block;
+        }
+    };
+}
+
+namespace gimo
+{
+    /**
+     * \brief The aggregated statistics of a single step.
+     */
+    struct StepStatistics
+    {
+        /**
+         * \brief How often the step has been entered with a value.
+         */
+        std::uint64_t values{};
+
+        /**
+         * \brief How often the step has been entered with a null.
+         */
+        std::uint64_t nulls{};
+
+        /**
+         * \brief The time spent in the step itself, i.e. excluding its subsequent steps.
+         * \note Is always zero, if the sink does not measure any time.
+         */
+        std::chrono::nanoseconds duration{};
+
+        /**
+         * \brief How often the step has been entered at all.
+         */
+        [[nodiscard]]
+        constexpr std::uint64_t invocations() const noexcept
+        {
+            return values + nulls;
+        }
+
+        [[nodiscard]]
+        friend bool operator==(StepStatistics const&, StepStatistics const&) = default;
+    };
+
+    /**
+     * \brief An `instrumentation_sink`, which counts the events of each step.
+     * \tparam Clock The clock to measure the step durations with; `void` disables the measurement.
+     * \details
+     * Each thread records into its own block of counters, thus recording is lock-free and does not suffer from contention.
+     * Only the first event of a thread synchronizes with the other threads, as it registers a new block.
+     * `snapshot` aggregates all blocks; the result is exact, once all pipelines which report into the sink have returned.
+     *
+     * A sink is meant to serve a single (instrumented) pipeline, as the step indices are shared otherwise.
+     * The sink must outlive all pipelines which report into it.
+     */
+    template <typename Clock = void>
+    class CounterSink
+    {
+    public:
+        using clock = Clock;
+
+        /**
+         * \brief Creates a sink for the given amount of steps.
+         * \param stepCount The number of steps of the instrumented pipeline.
+         */
+        [[nodiscard]]
+        explicit CounterSink(std::size_t const stepCount)
+            : m_StepCount{stepCount}
+        {
+        }
+
+        CounterSink(CounterSink const&) = delete;
+        CounterSink& operator=(CounterSink const&) = delete;
+        CounterSink(CounterSink&&) = delete;
+        CounterSink& operator=(CounterSink&&) = delete;
+
+        /**
+         * \brief Returns the number of steps, this sink has been created for.
+         */
+        [[nodiscard]]
+        std::size_t step_count() const noexcept
+        {
+            return m_StepCount;
+        }
+
+        void on_value(std::size_t const step) noexcept
+        {
+            increment(step, valueSlot, 1u);
+        }
+
+        void on_null(std::size_t const step) noexcept
+        {
+            increment(step, nullSlot, 1u);
+        }
+
+        template <typename Rep, typename Period>
+            requires(!std::is_void_v<Clock>)
+        void on_duration(std::size_t const step, std::chrono::duration<Rep, Period> const duration) noexcept
+        {
+            auto const ticks = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+            increment(step, durationSlot, static_cast<std::uint64_t>(std::max<decltype(ticks)>(ticks, 0)));
+        }
+
+        /**
+         * \brief Aggregates the recorded events of all threads.
+         * \return The statistics of each step, in pipeline order.
+         */
+        [[nodiscard]]
+        std::vector<StepStatistics> snapshot() const
+        {
+            std::vector<StepStatistics> statistics(m_StepCount);
+            std::vector<std::uint64_t> inclusive(m_StepCount);
+
+            m_Blocks.for_each([&]([[maybe_unused]] std::size_t const thread, Block const& block) {
+                for (std::size_t step{0u}; step < m_StepCount; ++step)
+                {
+                    statistics[step].values += load(block, step, valueSlot);
+                    statistics[step].nulls += load(block, step, nullSlot);
+                    inclusive[step] += load(block, step, durationSlot);
+                }
+            });
+
+            // Each step encloses its successor, thus the inclusive durations are converted into exclusive ones.
+            for (std::size_t step{0u}; step < m_StepCount; ++step)
+            {
+                std::uint64_t const successor = step + 1u < m_StepCount ? inclusive[step + 1u] : 0u;
+                statistics[step].duration = std::chrono::nanoseconds{
+                    static_cast<std::chrono::nanoseconds::rep>(inclusive[step] - std::min(inclusive[step], successor))};
+            }
+
+            return statistics;
+        }
+
+    private:
+        static constexpr std::size_t valueSlot{0u};
+        static constexpr std::size_t nullSlot{1u};
+        static constexpr std::size_t durationSlot{2u};
+        static constexpr std::size_t slotCount{3u};
+
+        struct Block
+        {
+            [[nodiscard]]
+            explicit Block(std::size_t const counterCount)
+                : counters{std::make_unique<std::atomic<std::uint64_t>[]>(counterCount)}
+            {
+            }
+
+            std::unique_ptr<std::atomic<std::uint64_t>[]> counters;
+        };
+
+        std::size_t m_StepCount;
+        detail::instrumentation::PerThread<Block> m_Blocks{};
+
+        [[nodiscard]]
+        std::uint64_t load(Block const& block, std::size_t const step, std::size_t const slot) const noexcept
+        {
+            return block.counters[step * slotCount + slot].load(std::memory_order_relaxed);
+        }
+
+        void increment(std::size_t const step, std::size_t const slot, std::uint64_t const amount) noexcept
+        {
+            GIMO_ASSERT(step < m_StepCount, "Step index out of range.", step);
+
+            Block& block = m_Blocks.local([this] { return std::make_unique<Block>(m_StepCount * slotCount); });
+
+            // The owning thread is the only writer, thus a plain load and store suffices.
+            std::atomic<std::uint64_t>& counter = block.counters[step * slotCount + slot];
+            counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * \brief Instruments each step of the pipeline, which then reports its events to the sink.
+     * \tparam Pipeline The pipeline type.
+     * \tparam Sink The sink type.
+     * \param steps The pipeline to instrument.
+     * \param sink The sink, which receives the events. Must outlive the returned pipeline.
+     * \return A pipeline, which performs the very same operations as `steps`.
+     * \details
+     * Each step reports, whether it's entered with a value or a null, and its duration, if the sink measures time.
+     * As each step must be entered to be counted, nulls are no longer fast-forwarded over consecutive steps.
+     *
+     * When `GIMO_INSTRUMENT` is defined as `0`, the pipeline is returned as-is; i.e. the result has the very same type
+     * as the input, which guarantees that no overhead remains.
+     */
+    template <pipeline Pipeline, instrumentation_sink Sink>
+    [[nodiscard]]
+    constexpr auto instrumented(Pipeline&& steps, [[maybe_unused]] Sink& sink)
+    {
+        if constexpr (0 == GIMO_INSTRUMENT)
+        {
+            return std::remove_cvref_t<Pipeline>{std::forward<Pipeline>(steps)};
+        }
+        else
+        {
+            return detail::instrumentation::instrument(std::forward<Pipeline>(steps), sink);
+        }
+    }
+}
+
+#endif
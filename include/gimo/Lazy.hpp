@@ -0,0 +1,225 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_LAZY_HPP
+#define GIMO_LAZY_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/Pipeline.hpp"
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    template <typename Source, pipeline Pipeline>
+    class Lazy;
+
+    namespace detail::lazy
+    {
+        template <typename T>
+        struct is_lazy
+            : public std::false_type
+        {
+        };
+
+        template <typename Source, typename Pipeline>
+        struct is_lazy<Lazy<Source, Pipeline>>
+            : public std::true_type
+        {
+        };
+
+        template <typename Source>
+        struct input
+        {
+            using type = Source;
+        };
+
+        template <typename Source>
+            requires is_lazy<Source>::value
+        struct input<Source>
+        {
+            using type = typename Source::result_type;
+        };
+
+        template <typename Source>
+        [[nodiscard]]
+        constexpr typename input<Source>::type&& take_input(Source& source)
+        {
+            if constexpr (is_lazy<Source>::value)
+            {
+                return std::move(source).result();
+            }
+            else
+            {
+                return std::move(source);
+            }
+        }
+
+        template <typename Source, typename Pipeline>
+        using result_t = decltype(std::declval<Pipeline&&>().apply(std::declval<typename input<Source>::type&&>()));
+    }
+
+    /**
+     * \brief A deferred pipeline execution, which is only performed, when its result is accessed.
+     * \tparam Source The input type; either a `nullable` or another `Lazy`.
+     * \tparam Pipeline The pipeline type.
+     * \details
+     * The input and the pipeline are stored by value. On the first access (e.g. `has_value` or `value`),
+     * the pipeline is applied on the input and the result is memoized; the input is consumed by that.
+     * Further steps can be attached via `apply` without forcing the evaluation.
+     *
+     * The evaluation also happens on `const` access, thus a single instance must not be accessed concurrently.
+     */
+    template <typename Source, pipeline Pipeline>
+    class Lazy
+    {
+    public:
+        using source_type = Source;
+        using pipeline_type = Pipeline;
+        using result_type = detail::lazy::result_t<Source, Pipeline>;
+
+        /**
+         * \brief Stores the input and the pipeline, without applying it.
+         * \param source The input.
+         * \param steps The pipeline to apply, when the result is accessed.
+         */
+        [[nodiscard]]
+        explicit constexpr Lazy(Source source, Pipeline steps)
+            noexcept(std::is_nothrow_move_constructible_v<Source> && std::is_nothrow_move_constructible_v<Pipeline>)
+            : m_Source{std::move(source)},
+              m_Steps{std::move(steps)}
+        {
+        }
+
+        /**
+         * \brief Determines, whether the result has already been computed.
+         */
+        [[nodiscard]]
+        constexpr bool is_evaluated() const noexcept
+        {
+            return m_Result.has_value();
+        }
+
+        /**
+         * \brief Determines, whether the result has a value.
+         * \note Evaluates the pipeline, if not done yet.
+         */
+        [[nodiscard]]
+        constexpr bool has_value() const
+        {
+            return detail::has_value(evaluate());
+        }
+
+        /**
+         * \brief Accesses the value of the result.
+         * \note Evaluates the pipeline, if not done yet.
+         * \attention The result must have a value.
+         */
+        [[nodiscard]]
+        constexpr decltype(auto) value() &
+        {
+            return detail::forward_value<result_type&>(evaluate());
+        }
+
+        /**
+         * \copydoc value
+         */
+        [[nodiscard]]
+        constexpr decltype(auto) value() const&
+        {
+            return detail::forward_value<result_type const&>(evaluate());
+        }
+
+        /**
+         * \copydoc value
+         */
+        [[nodiscard]]
+        constexpr decltype(auto) value() &&
+        {
+            return detail::forward_value<result_type>(evaluate());
+        }
+
+        /**
+         * \brief Accesses the result.
+         * \note Evaluates the pipeline, if not done yet.
+         */
+        [[nodiscard]]
+        constexpr result_type& result() &
+        {
+            return evaluate();
+        }
+
+        /**
+         * \copydoc result
+         */
+        [[nodiscard]]
+        constexpr result_type const& result() const&
+        {
+            return evaluate();
+        }
+
+        /**
+         * \copydoc result
+         */
+        [[nodiscard]]
+        constexpr result_type&& result() &&
+        {
+            return std::move(evaluate());
+        }
+
+        /**
+         * \brief Attaches further steps, without forcing the evaluation.
+         * \tparam SuffixSteps The steps of the attached pipeline.
+         * \param suffix The pipeline, which is applied on the result of this one.
+         * \return A new `Lazy`, which takes over this instance as its input.
+         */
+        template <typename... SuffixSteps>
+        [[nodiscard]]
+        constexpr auto apply(gimo::Pipeline<SuffixSteps...> suffix) &&
+        {
+            return Lazy<Lazy, gimo::Pipeline<SuffixSteps...>>{std::move(*this), std::move(suffix)};
+        }
+
+    private:
+        mutable Source m_Source;
+        GIMO_NO_UNIQUE_ADDRESS mutable Pipeline m_Steps;
+        mutable std::optional<result_type> m_Result{};
+
+        constexpr result_type& evaluate() const
+        {
+            if (!m_Result)
+            {
+                m_Result.emplace(std::move(m_Steps).apply(detail::lazy::take_input(m_Source)));
+            }
+
+            return *m_Result;
+        }
+    };
+
+    /**
+     * \brief Creates a deferred execution of the pipeline on the input.
+     * \relates Lazy
+     * \tparam Nullable The input type.
+     * \tparam Pipeline The pipeline type.
+     * \param opt The input value; stored by value.
+     * \param steps The pipeline to execute; stored by value.
+     * \return A `Lazy`, which applies the pipeline on first access.
+     */
+    template <nullable Nullable, pipeline Pipeline>
+    [[nodiscard]]
+    constexpr auto lazy(Nullable&& opt, Pipeline&& steps)
+    {
+        return Lazy<std::remove_cvref_t<Nullable>, std::remove_cvref_t<Pipeline>>{
+            std::forward<Nullable>(opt),
+            std::forward<Pipeline>(steps)};
+    }
+}
+
+#endif
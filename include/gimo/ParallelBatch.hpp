@@ -0,0 +1,83 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_PARALLEL_BATCH_HPP
+#define GIMO_PARALLEL_BATCH_HPP
+
+#pragma once
+
+/*
+ * This header is intentionally not part of `gimo.hpp`, as some standard-libraries (e.g. libstdc++) implement
+ * the parallel algorithms on top of TBB, which then must be linked. The `gimo::parallel` cmake target takes care of that.
+ */
+
+#include "gimo/Batch.hpp"
+#include "gimo/Pipeline.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<execution>)
+    #include <execution>
+#endif
+
+#ifdef __cpp_lib_execution
+
+namespace gimo
+{
+    /**
+     * \brief Applies each element of the input-range on the pipeline and writes the results into the output,
+     * according to the given execution-policy.
+     * \tparam ExecutionPolicy The execution-policy type.
+     * \tparam Range The input-range type.
+     * \tparam Pipeline The pipeline type.
+     * \tparam Out The output-iterator type.
+     * \param policy The execution-policy (e.g. `std::execution::par`).
+     * \param range The elements to process.
+     * \param pipeline The pipeline to execute for each element.
+     * \param out The beginning of the destination.
+     * \return The end of the input-range and the output-iterator past the last written element.
+     * \details
+     * This is built on top of `std::transform` and thus inherits its requirements and guarantees.
+     * The very same pipeline object is shared by all threads, which apply it via the `const&` overload of `apply`.
+     *
+     * \attention The actions of the pipeline are invoked concurrently (as `const` objects).
+     * Therefore, each action must be safe to be called from multiple threads simultaneously,
+     * which means it must not modify any state without proper synchronization.
+     * In addition, the actions must not throw, as any escaping exception leads to `std::terminate`.
+     * For the unsequenced policies (e.g. `std::execution::par_unseq`) the actions must also be free of any synchronization,
+     * like locking a mutex or allocating memory.
+     */
+    template <typename ExecutionPolicy, std::ranges::forward_range Range, pipeline Pipeline, std::forward_iterator Out>
+        requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+              && std::ranges::common_range<Range>
+              && processable_by<std::ranges::range_reference_t<Range>, Pipeline const&>
+              && std::indirectly_writable<Out, detail::apply_result_t<std::ranges::range_reference_t<Range>, Pipeline>>
+    std::ranges::in_out_result<std::ranges::borrowed_iterator_t<Range>, Out> apply_each(
+        ExecutionPolicy&& policy,
+        Range&& range,
+        Pipeline const& pipeline,
+        Out out)
+    {
+        // The policy is passed as lvalue on purpose, as some implementations reject rvalue policies.
+        Out last = std::transform(
+            policy,
+            std::ranges::begin(range),
+            std::ranges::end(range),
+            std::move(out),
+            [&pipeline](std::ranges::range_reference_t<Range> element) {
+                return pipeline.apply(std::forward<std::ranges::range_reference_t<Range>>(element));
+            });
+
+        return {std::ranges::end(range), std::move(last)};
+    }
+}
+
+#endif
+
+#endif
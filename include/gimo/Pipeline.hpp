@@ -9,8 +9,11 @@
 #pragma once
 
 #include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
 #include "gimo/algorithm/BasicAlgorithm.hpp"
 
+#include <array>
+#include <cstddef>
 #include <functional>
 #include <tuple>
 #include <type_traits>
@@ -18,6 +21,180 @@
 
 namespace gimo
 {
+    template <typename... Steps>
+    class Pipeline;
+
+    namespace detail::compressed_tuple
+    {
+        /**
+         * \brief Determines, whether objects of the type are indistinguishable from each other.
+         * \details Such elements are not stored at all, but are materialized on each access.
+         */
+        template <typename T>
+        concept elidable = std::is_empty_v<T>
+                        && std::is_trivially_default_constructible_v<T>
+                        && std::is_trivially_copyable_v<T>;
+
+        template <std::size_t index, typename T>
+        class Leaf
+        {
+        public:
+            static constexpr std::size_t elementIndex{index};
+
+            template <typename Arg>
+            [[nodiscard]]
+            explicit constexpr Leaf([[maybe_unused]] std::in_place_t const tag, Arg&& arg)
+                noexcept(std::is_nothrow_constructible_v<T, Arg&&>)
+                : m_Value(std::forward<Arg>(arg))
+            {
+            }
+
+            template <typename Self>
+            [[nodiscard]]
+            static constexpr const_ref_like_t<Self&&, T> get(Self&& self) noexcept
+            {
+                return static_cast<const_ref_like_t<Self&&, T>>(
+                    static_cast<const_ref_like_t<Self&&, Leaf>>(self).m_Value);
+            }
+
+        private:
+            GIMO_NO_UNIQUE_ADDRESS T m_Value;
+        };
+
+        template <std::size_t index, elidable T>
+        class Leaf<index, T>
+        {
+        public:
+            static constexpr std::size_t elementIndex{index};
+
+            template <typename Arg>
+            [[nodiscard]]
+            explicit constexpr Leaf(
+                [[maybe_unused]] std::in_place_t const tag,
+                [[maybe_unused]] Arg&& arg) noexcept
+            {
+            }
+
+            template <typename Self>
+            [[nodiscard]]
+            static constexpr T get([[maybe_unused]] Self&& self) noexcept
+            {
+                return T{};
+            }
+        };
+
+        /**
+         * \brief Determines the order of the leaves, which is descending by alignment and stable otherwise.
+         */
+        template <typename... Ts>
+        consteval std::array<std::size_t, sizeof...(Ts)> storage_order()
+        {
+            constexpr std::array<std::size_t, sizeof...(Ts)> alignments{alignof(Ts)...};
+            std::array<std::size_t, sizeof...(Ts)> order{};
+            for (std::size_t i{0u}; i < order.size(); ++i)
+            {
+                std::size_t position{i};
+                for (; 0u < position && alignments[order[position - 1u]] < alignments[i]; --position)
+                {
+                    order[position] = order[position - 1u];
+                }
+
+                order[position] = i;
+            }
+
+            return order;
+        }
+
+        template <typename... Leaves>
+        class GIMO_EMPTY_BASES Storage
+            : public Leaves...
+        {
+        public:
+            template <typename... Args>
+            [[nodiscard]]
+            explicit constexpr Storage(std::tuple<Args...>&& args)
+                : Leaves{std::in_place, std::get<Leaves::elementIndex>(std::move(args))}...
+            {
+            }
+        };
+
+        template <typename... Ts>
+        struct storage_for
+        {
+            static constexpr std::array order = storage_order<Ts...>();
+
+            template <std::size_t... positions>
+            static auto make([[maybe_unused]] std::index_sequence<positions...> const tag)
+                -> Storage<Leaf<order[positions], std::tuple_element_t<order[positions], std::tuple<Ts...>>>...>;
+
+            using type = decltype(make(std::index_sequence_for<Ts...>{}));
+        };
+
+        /**
+         * \brief A tuple-like storage, which omits stateless elements and orders the remaining ones to minimize padding.
+         * \tparam Ts The element types.
+         * \details
+         * Unlike `std::tuple`, an instance, which solely consists of stateless elements, is empty.
+         * The elements are only accessible all at once via `apply`.
+         */
+        template <typename... Ts>
+        class GIMO_EMPTY_BASES CompressedTuple
+            : private storage_for<Ts...>::type
+        {
+            using Base = typename storage_for<Ts...>::type;
+
+        public:
+            template <typename... Args>
+                requires(sizeof...(Ts) == sizeof...(Args))
+            [[nodiscard]]
+            explicit constexpr CompressedTuple([[maybe_unused]] std::in_place_t const tag, Args&&... args)
+                : Base{std::forward_as_tuple(std::forward<Args>(args)...)}
+            {
+            }
+
+            /**
+             * \brief Invokes `fun` with all elements, which are forwarded like `self`.
+             * \details Stateless elements are materialized as temporaries, which live until `fun` returns.
+             */
+            template <typename Self, typename Fun>
+            static constexpr decltype(auto) apply(Self&& self, Fun&& fun)
+                noexcept(std::is_nothrow_invocable_v<Fun, const_ref_like_t<Self&&, Ts>...>)
+            {
+                return [&]<std::size_t... indices>([[maybe_unused]] std::index_sequence<indices...> const tag) -> decltype(auto) {
+                    return std::invoke(
+                        std::forward<Fun>(fun),
+                        forward_element<Self, Ts>(
+                            Leaf<indices, Ts>::get(static_cast<const_ref_like_t<Self&&, Base>>(self)))...);
+                }(std::index_sequence_for<Ts...>{});
+            }
+
+        private:
+            template <typename Self, typename T, typename Element>
+            [[nodiscard]]
+            static constexpr const_ref_like_t<Self&&, T> forward_element(Element&& element) noexcept
+            {
+                return static_cast<const_ref_like_t<Self&&, T>>(element);
+            }
+        };
+    }
+
+    namespace detail
+    {
+        struct pipeline_access;
+
+        template <typename Nullable, typename Pipeline, typename StepList = std::remove_cvref_t<Pipeline>>
+        struct is_nothrow_processable_by
+            : public std::false_type
+        {
+        };
+
+        template <typename Nullable, typename ConstRefSource, typename... Steps>
+        struct is_nothrow_processable_by<Nullable, ConstRefSource, Pipeline<Steps...>>
+            : public is_nothrow_processable_impl<Nullable, const_ref_like_t<ConstRefSource, Steps>...>
+        {
+        };
+    }
+
     /**
      * \brief A composite object representing a sequence of monadic operations.
      * \tparam Steps The sequence of algorithm types contained in this pipeline.
@@ -31,6 +208,8 @@ namespace gimo
         template <typename... Others>
         friend class Pipeline;
 
+        friend struct detail::pipeline_access;
+
     public:
         /**
          * \brief Constructs a pipeline from a tuple of steps.
@@ -38,7 +217,7 @@ namespace gimo
          */
         [[nodiscard]]
         explicit constexpr Pipeline(std::tuple<Steps...> steps)
-            : m_Steps{std::move(steps)}
+            : m_Steps{std::make_from_tuple<Storage>(std::tuple_cat(std::tuple{std::in_place}, std::move(steps)))}
         {
         }
 
@@ -47,9 +226,11 @@ namespace gimo
          * \tparam Nullable The input type.
          * \param opt The input value to process.
          * \return The result of the pipeline execution.
+         * \note The pipeline is `noexcept`, if the input is `nothrow_processable_by` it.
          */
         template <nullable Nullable>
         constexpr auto apply(Nullable&& opt) &
+            noexcept(detail::is_nothrow_processable_by<Nullable, Pipeline&>::value)
         {
             return apply(*this, std::forward<Nullable>(opt));
         }
@@ -59,6 +240,7 @@ namespace gimo
          */
         template <nullable Nullable>
         constexpr auto apply(Nullable&& opt) const&
+            noexcept(detail::is_nothrow_processable_by<Nullable, Pipeline const&>::value)
         {
             return apply(*this, std::forward<Nullable>(opt));
         }
@@ -68,6 +250,7 @@ namespace gimo
          */
         template <nullable Nullable>
         constexpr auto apply(Nullable&& opt) &&
+            noexcept(detail::is_nothrow_processable_by<Nullable, Pipeline&&>::value)
         {
             return apply(std::move(*this), std::forward<Nullable>(opt));
         }
@@ -77,6 +260,7 @@ namespace gimo
          */
         template <nullable Nullable>
         constexpr auto apply(Nullable&& opt) const&&
+            noexcept(detail::is_nothrow_processable_by<Nullable, Pipeline const&&>::value)
         {
             return apply(std::move(*this), std::forward<Nullable>(opt));
         }
@@ -89,7 +273,7 @@ namespace gimo
         template <typename... SuffixSteps>
         constexpr auto append(Pipeline<SuffixSteps...> suffix) const&
         {
-            return append(*this, std::move(suffix.m_Steps));
+            return append(*this, std::move(suffix));
         }
 
         /**
@@ -98,7 +282,7 @@ namespace gimo
         template <typename... SuffixSteps>
         constexpr auto append(Pipeline<SuffixSteps...> suffix) &&
         {
-            return append(std::move(*this), std::move(suffix.m_Steps));
+            return append(std::move(*this), std::move(suffix));
         }
 
         /**
@@ -124,35 +308,75 @@ namespace gimo
         }
 
     private:
-        std::tuple<Steps...> m_Steps{};
+        using Storage = detail::compressed_tuple::CompressedTuple<Steps...>;
+
+        GIMO_NO_UNIQUE_ADDRESS Storage m_Steps;
+
+        [[nodiscard]]
+        explicit constexpr Pipeline(Storage&& steps)
+            : m_Steps{std::move(steps)}
+        {
+        }
 
         template <typename Self, typename Nullable>
         [[nodiscard]]
         static constexpr auto apply(Self&& self, Nullable&& opt)
+            noexcept(detail::is_nothrow_processable_by<Nullable, Self&&>::value)
         {
-            return std::apply(
-                [&]<typename First, typename... Others>(First&& first, Others&&... steps) {
+            return Storage::apply(
+                std::forward<Self>(self).m_Steps,
+                [&]<typename First, typename... Others>(First&& first, Others&&... steps)
+                    noexcept(detail::is_nothrow_processable_by<Nullable, Self&&>::value) {
                     return std::invoke(
                         std::forward<First>(first),
                         std::forward<Nullable>(opt),
                         std::forward<Others>(steps)...);
-                },
-                std::forward<Self>(self).m_Steps);
+                });
         }
 
         template <typename Self, typename... SuffixSteps>
         [[nodiscard]]
-        static constexpr auto append(Self&& self, std::tuple<SuffixSteps...>&& suffixSteps)
+        static constexpr auto append(Self&& self, Pipeline<SuffixSteps...>&& suffix)
         {
             using Appended = Pipeline<Steps..., SuffixSteps...>;
+            using SuffixStorage = typename Pipeline<SuffixSteps...>::Storage;
 
-            return Appended{
-                std::tuple_cat(std::forward<Self>(self).m_Steps, std::move(suffixSteps))};
+            return Storage::apply(
+                std::forward<Self>(self).m_Steps,
+                [&]<typename... Prefix>(Prefix&&... prefix) {
+                    return SuffixStorage::apply(
+                        std::move(suffix.m_Steps),
+                        [&]<typename... Suffix>(Suffix&&... rest) {
+                            return Appended{
+                                typename Appended::Storage{
+                                    std::in_place,
+                                    std::forward<Prefix>(prefix)...,
+                                    std::forward<Suffix>(rest)...}};
+                        });
+                });
         }
     };
 
     namespace detail
     {
+        /**
+         * \brief Grants library internals access to the individual steps of a pipeline.
+         */
+        struct pipeline_access
+        {
+            /**
+             * \brief Invokes `fun` with all steps of the pipeline, in order.
+             * \details The steps are forwarded with the value-category of the pipeline.
+             */
+            template <typename Pipeline, typename Fun>
+            static constexpr decltype(auto) apply_steps(Pipeline&& steps, Fun&& fun)
+            {
+                using Storage = typename std::remove_cvref_t<Pipeline>::Storage;
+
+                return Storage::apply(std::forward<Pipeline>(steps).m_Steps, std::forward<Fun>(fun));
+            }
+        };
+
         template <typename T>
         struct is_pipeline
             : public std::false_type
@@ -181,10 +405,12 @@ namespace gimo
      * \param opt The input value to process.
      * \param steps The pipeline to execute.
      * \return The result of the pipeline execution.
+     * \note The call is `noexcept`, if the input is `nothrow_processable_by` the pipeline.
      */
     template <nullable Nullable, pipeline Pipeline>
     [[nodiscard]]
     constexpr auto apply(Nullable&& opt, Pipeline&& steps)
+        noexcept(detail::is_nothrow_processable_by<Nullable, Pipeline&&>::value)
     {
         return std::forward<Pipeline>(steps).apply(std::forward<Nullable>(opt));
     }
@@ -201,7 +427,7 @@ namespace gimo
             requires applicable_to<Nullable, const_ref_like_t<ConstRefSource, First>>
         struct is_processable_by_impl<Nullable, ConstRefSource, First, Rest...>
             : public is_processable_by_impl<
-                  std::invoke_result_t<const_ref_like_t<ConstRefSource, First>, Nullable>,
+                  step_next_input_t<const_ref_like_t<ConstRefSource, First>, Nullable>,
                   ConstRefSource,
                   Rest...>
         {
@@ -226,6 +452,18 @@ namespace gimo
     concept processable_by = nullable<Nullable>
                           && pipeline<Pipeline>
                           && detail::is_processable_by<Nullable, Pipeline>::value;
+
+    /**
+     * \brief Evaluates whether a `Nullable` type can be processed by the entire pipeline without emitting any exception.
+     * \tparam Nullable The nullable type.
+     * \tparam Pipeline A `Pipeline` specialization.
+     * \details
+     * Each step must be `nothrow_applicable_to` its input, regardless whether that holds a value or not.
+     * This also covers the construction of every intermediate result.
+     */
+    template <typename Nullable, typename Pipeline>
+    concept nothrow_processable_by = processable_by<Nullable, Pipeline>
+                                  && detail::is_nothrow_processable_by<Nullable, Pipeline>::value;
 }
 
 #endif
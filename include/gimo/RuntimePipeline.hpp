@@ -0,0 +1,208 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_RUNTIME_PIPELINE_HPP
+#define GIMO_RUNTIME_PIPELINE_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/BasicAlgorithm.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gimo
+{
+    namespace detail::runtime_pipeline
+    {
+        template <typename Nullable, typename Pipeline>
+        struct is_null_propagating
+            : public std::false_type
+        {
+        };
+
+        /**
+         * \brief Determines, whether each step of the pipeline merely propagates the null-state of the `Nullable`.
+         */
+        template <typename Nullable, typename... Steps>
+        struct is_null_propagating<Nullable, gimo::Pipeline<Steps...>>
+            : public std::bool_constant<
+                  null_propagation<Nullable, Nullable, Steps const&...>::skipped == sizeof...(Steps)
+                  && std::same_as<Nullable, typename null_propagation<Nullable, Nullable, Steps const&...>::type>>
+        {
+        };
+
+        template <typename Nullable, typename Pipeline>
+        [[nodiscard]]
+        Nullable apply(void const* const pipeline, Nullable&& input)
+        {
+            return static_cast<Pipeline const*>(pipeline)->apply(std::move(input));
+        }
+
+        template <typename Pipeline>
+        void destroy(void const* const pipeline) noexcept
+        {
+            delete static_cast<Pipeline const*>(pipeline);
+        }
+    }
+
+    /**
+     * \brief Determines, whether the pipeline can be used as a step of a `RuntimePipeline<Nullable>`.
+     * \tparam Pipeline The pipeline type.
+     * \tparam Nullable The nullable type, which is the input and the result of each step.
+     */
+    template <typename Pipeline, typename Nullable>
+    concept runtime_step_for = pipeline<Pipeline>
+                            && processable_by<Nullable, Pipeline const&>
+                            && std::same_as<Nullable, decltype(std::declval<Pipeline const&>().apply(std::declval<Nullable>()))>;
+
+    /**
+     * \brief A type-erased pipeline, which is intended to be composed into a `RuntimePipeline`.
+     * \tparam Nullable The nullable type, which is the input and the result of the step.
+     */
+    template <nullable Nullable>
+        requires std::same_as<Nullable, std::remove_cvref_t<Nullable>>
+    class ErasedStep
+    {
+        template <nullable>
+            requires std::same_as<Nullable, std::remove_cvref_t<Nullable>>
+        friend class RuntimePipeline;
+
+    public:
+        /**
+         * \brief Erases the given pipeline.
+         * \tparam Pipeline The pipeline type.
+         * \param steps The pipeline to erase.
+         */
+        template <runtime_step_for<Nullable> Pipeline>
+        [[nodiscard]]
+        explicit(false) ErasedStep(Pipeline steps)
+            : m_Pipeline{
+                  new Pipeline(std::move(steps)),
+                  &detail::runtime_pipeline::destroy<Pipeline>},
+              m_Apply{&detail::runtime_pipeline::apply<Nullable, Pipeline>},
+              m_PropagatesNull{detail::runtime_pipeline::is_null_propagating<Nullable, Pipeline>::value}
+        {
+        }
+
+        /**
+         * \brief Determines, whether the step merely propagates the null-state of its input.
+         * \details Such steps are skipped entirely for null inputs.
+         */
+        [[nodiscard]]
+        bool propagates_null() const noexcept
+        {
+            return m_PropagatesNull;
+        }
+
+    private:
+        std::unique_ptr<void const, void (*)(void const*) noexcept> m_Pipeline;
+        Nullable (*m_Apply)(void const*, Nullable&&);
+        bool m_PropagatesNull;
+    };
+
+    /**
+     * \brief A pipeline, whose steps are composed at runtime.
+     * \tparam Nullable The nullable type, which is the input and the result of each step.
+     * \details
+     * The steps are compiled into a flat table of function-pointers.
+     * Additionally, each position denotes the next step, which actually has to handle a null input.
+     * Null inputs thus jump directly over all steps, which would merely propagate them; which mirrors the behaviour of `BasicAlgorithm::on_null`.
+     * Each executed step costs exactly one indirect call.
+     */
+    template <nullable Nullable>
+        requires std::same_as<Nullable, std::remove_cvref_t<Nullable>>
+    class RuntimePipeline
+    {
+    public:
+        /**
+         * \brief Creates a pipeline without any steps, which returns its input unchanged.
+         */
+        [[nodiscard]]
+        RuntimePipeline() = default;
+
+        /**
+         * \brief Compiles the given steps.
+         * \param steps The steps to execute, in order.
+         */
+        [[nodiscard]]
+        explicit RuntimePipeline(std::vector<ErasedStep<Nullable>> steps)
+            : m_Steps{std::move(steps)},
+              m_Entries(m_Steps.size()),
+              m_NullTargets(m_Steps.size() + 1u)
+        {
+            std::size_t nullTarget{m_Steps.size()};
+            m_NullTargets.back() = nullTarget;
+            for (std::size_t i{m_Steps.size()}; 0u < i; --i)
+            {
+                ErasedStep<Nullable> const& step = m_Steps[i - 1u];
+                m_Entries[i - 1u] = Entry{.apply = step.m_Apply, .pipeline = step.m_Pipeline.get()};
+                if (!step.propagates_null())
+                {
+                    nullTarget = i - 1u;
+                }
+
+                m_NullTargets[i - 1u] = nullTarget;
+            }
+        }
+
+        /**
+         * \brief Returns the number of steps.
+         */
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return m_Entries.size();
+        }
+
+        /**
+         * \brief Applies the input on all steps.
+         * \param input The input value to process.
+         * \return The result of the last executed step.
+         */
+        [[nodiscard]]
+        Nullable apply(Nullable input) const
+        {
+            std::size_t const count = m_Entries.size();
+            std::size_t index{0u};
+            while (true)
+            {
+                if (!detail::has_value(input))
+                {
+                    index = m_NullTargets[index];
+                }
+
+                if (index == count)
+                {
+                    return input;
+                }
+
+                Entry const& entry = m_Entries[index];
+                input = entry.apply(entry.pipeline, std::move(input));
+                ++index;
+            }
+        }
+
+    private:
+        struct Entry
+        {
+            Nullable (*apply)(void const*, Nullable&&){};
+            void const* pipeline{};
+        };
+
+        std::vector<ErasedStep<Nullable>> m_Steps{};
+        std::vector<Entry> m_Entries{};
+        std::vector<std::size_t> m_NullTargets{0u};
+    };
+}
+
+#endif
@@ -0,0 +1,378 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_TASK_HPP
+#define GIMO_TASK_HPP
+
+#pragma once
+
+#include "gimo/Config.hpp"
+
+#include <concepts>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gimo
+{
+    template <typename T>
+    class Task;
+
+    namespace detail::task
+    {
+        template <typename T>
+        class Promise
+        {
+        public:
+            [[nodiscard]]
+            Task<T> get_return_object() noexcept
+            {
+                return Task<T>{std::coroutine_handle<Promise>::from_promise(*this)};
+            }
+
+            [[nodiscard]]
+            static constexpr std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            [[nodiscard]]
+            static constexpr auto final_suspend() noexcept
+            {
+                struct Awaiter
+                {
+                    [[nodiscard]]
+                    static constexpr bool await_ready() noexcept
+                    {
+                        return false;
+                    }
+
+                    [[nodiscard]]
+                    static std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> const handle) noexcept
+                    {
+                        return handle.promise().m_Continuation;
+                    }
+
+                    static constexpr void await_resume() noexcept
+                    {
+                    }
+                };
+
+                return Awaiter{};
+            }
+
+            template <typename Value>
+                requires std::constructible_from<T, Value&&>
+            void return_value(Value&& value)
+            {
+                m_Result.emplace(std::forward<Value>(value));
+            }
+
+            void unhandled_exception() noexcept
+            {
+                m_Exception = std::current_exception();
+            }
+
+            void set_continuation(std::coroutine_handle<> const continuation) noexcept
+            {
+                m_Continuation = continuation;
+            }
+
+            [[nodiscard]]
+            T take_result()
+            {
+                if (m_Exception)
+                {
+                    std::rethrow_exception(m_Exception);
+                }
+
+                GIMO_ASSERT(m_Result, "Task must be completed.");
+
+                return *std::move(m_Result);
+            }
+
+        private:
+            std::coroutine_handle<> m_Continuation{std::noop_coroutine()};
+            std::optional<T> m_Result{};
+            std::exception_ptr m_Exception{};
+        };
+
+        /**
+         * \brief A one-shot countdown, which may be signaled from any thread.
+         */
+        class Latch
+        {
+        public:
+            [[nodiscard]]
+            explicit Latch(std::size_t const count) noexcept
+                : m_Count{count}
+            {
+            }
+
+            void count_down()
+            {
+                // Notifying under the lock prevents the waiter from destroying the latch too early.
+                std::scoped_lock const lock{m_Mutex};
+                if (0u == --m_Count)
+                {
+                    m_Condition.notify_all();
+                }
+            }
+
+            void wait()
+            {
+                std::unique_lock lock{m_Mutex};
+                m_Condition.wait(lock, [this] { return 0u == m_Count; });
+            }
+
+        private:
+            std::mutex m_Mutex{};
+            std::condition_variable m_Condition{};
+            std::size_t m_Count;
+        };
+
+        /**
+         * \brief An eagerly started coroutine, which destroys itself on completion.
+         */
+        struct Detached
+        {
+            struct promise_type
+            {
+                [[nodiscard]]
+                static constexpr Detached get_return_object() noexcept
+                {
+                    return {};
+                }
+
+                [[nodiscard]]
+                static constexpr std::suspend_never initial_suspend() noexcept
+                {
+                    return {};
+                }
+
+                [[nodiscard]]
+                static constexpr std::suspend_never final_suspend() noexcept
+                {
+                    return {};
+                }
+
+                static constexpr void return_void() noexcept
+                {
+                }
+
+                [[noreturn]]
+                static void unhandled_exception() noexcept
+                {
+                    std::terminate();
+                }
+            };
+        };
+
+        template <typename T>
+        Detached await_into(Task<T> task, std::optional<T>& result, std::exception_ptr& exception, Latch& latch)
+        {
+            try
+            {
+                result.emplace(co_await std::move(task));
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+
+            latch.count_down();
+        }
+    }
+
+    /**
+     * \brief A lazily started coroutine, which produces a single `T`.
+     * \tparam T The result type.
+     * \details
+     * The task does not run, until it's awaited. When the task completes, the awaiting coroutine is resumed on
+     * the very same thread (via symmetric transfer), which may differ from the thread, which started the task.
+     *
+     * Tasks may also be created from an already available result; awaiting them never suspends.
+     */
+    template <typename T>
+    class [[nodiscard]] Task
+    {
+    public:
+        using promise_type = detail::task::Promise<T>;
+        using value_type = T;
+
+        /**
+         * \brief Creates an already completed task.
+         * \param result The result of the task.
+         */
+        [[nodiscard]]
+        explicit Task(T result) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : m_Ready{std::move(result)}
+        {
+        }
+
+        ~Task() noexcept
+        {
+            if (m_Handle)
+            {
+                m_Handle.destroy();
+            }
+        }
+
+        Task(Task const&) = delete;
+        Task& operator=(Task const&) = delete;
+
+        [[nodiscard]]
+        Task(Task&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : m_Handle{std::exchange(other.m_Handle, nullptr)},
+              m_Ready{std::move(other.m_Ready)}
+        {
+        }
+
+        Task& operator=(Task&& other) noexcept(std::is_nothrow_move_assignable_v<T>)
+        {
+            if (this != std::addressof(other))
+            {
+                if (m_Handle)
+                {
+                    m_Handle.destroy();
+                }
+
+                m_Handle = std::exchange(other.m_Handle, nullptr);
+                m_Ready = std::move(other.m_Ready);
+            }
+
+            return *this;
+        }
+
+        /**
+         * \brief Determines, whether the task is already completed without being awaited.
+         */
+        [[nodiscard]]
+        bool is_ready() const noexcept
+        {
+            return !m_Handle;
+        }
+
+        [[nodiscard]]
+        auto operator co_await() && noexcept
+        {
+            struct Awaiter
+            {
+                Task& task;
+
+                [[nodiscard]]
+                bool await_ready() const noexcept
+                {
+                    return task.is_ready();
+                }
+
+                [[nodiscard]]
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> const continuation) const noexcept
+                {
+                    task.m_Handle.promise().set_continuation(continuation);
+
+                    return task.m_Handle;
+                }
+
+                [[nodiscard]]
+                T await_resume() const
+                {
+                    if (task.is_ready())
+                    {
+                        GIMO_ASSERT(task.m_Ready, "Task must not be moved-from.");
+
+                        return *std::move(task.m_Ready);
+                    }
+
+                    return task.m_Handle.promise().take_result();
+                }
+            };
+
+            return Awaiter{*this};
+        }
+
+    private:
+        friend promise_type;
+
+        std::coroutine_handle<promise_type> m_Handle{};
+        std::optional<T> m_Ready{};
+
+        [[nodiscard]]
+        explicit Task(std::coroutine_handle<promise_type> const handle) noexcept
+            : m_Handle{handle}
+        {
+        }
+    };
+
+    /**
+     * \brief Runs the task and blocks the current thread, until it completes.
+     * \tparam T The result type.
+     * \param task The task to run.
+     * \return The result of the task.
+     * \throws Rethrows any exception, which escaped the task.
+     */
+    template <typename T>
+    [[nodiscard]]
+    T sync_wait(Task<T> task)
+    {
+        std::optional<T> result{};
+        std::exception_ptr exception{};
+        detail::task::Latch latch{1u};
+        detail::task::await_into(std::move(task), result, exception, latch);
+        latch.wait();
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+
+        return *std::move(result);
+    }
+
+    /**
+     * \brief Starts all tasks at once and blocks the current thread, until each of them completes.
+     * \tparam T The result type.
+     * \param tasks The tasks to run.
+     * \return The results in the order of the tasks.
+     * \throws Rethrows the first exception (by position), which escaped any task.
+     * \details Each task runs on the current thread, until it suspends for the first time; thus their waiting periods overlap.
+     */
+    template <typename T>
+    [[nodiscard]]
+    std::vector<T> sync_wait_all(std::vector<Task<T>> tasks)
+    {
+        std::vector<std::optional<T>> results(tasks.size());
+        std::vector<std::exception_ptr> exceptions(tasks.size());
+        detail::task::Latch latch{tasks.size()};
+        for (std::size_t i{0u}; i < tasks.size(); ++i)
+        {
+            detail::task::await_into(std::move(tasks[i]), results[i], exceptions[i], latch);
+        }
+        latch.wait();
+
+        std::vector<T> values{};
+        values.reserve(results.size());
+        for (std::size_t i{0u}; i < results.size(); ++i)
+        {
+            if (exceptions[i])
+            {
+                std::rethrow_exception(exceptions[i]);
+            }
+
+            values.emplace_back(*std::move(results[i]));
+        }
+
+        return values;
+    }
+}
+
+#endif
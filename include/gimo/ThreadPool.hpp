@@ -0,0 +1,137 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_THREAD_POOL_HPP
+#define GIMO_THREAD_POOL_HPP
+
+#pragma once
+
+#include "gimo/Config.hpp"
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gimo
+{
+    /**
+     * \brief A minimal scheduler, which resumes coroutines on a fixed set of worker threads.
+     * \details
+     * Coroutines are transferred onto a worker via `co_await pool.schedule()`.
+     * The pool is mainly intended for tests and benchmarks of asynchronous pipelines and thus favors simplicity over throughput.
+     *
+     * On destruction, all already scheduled coroutines are resumed, before the workers are joined.
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * \brief Starts the worker threads.
+         * \param threadCount The number of worker threads. Must be greater than zero.
+         */
+        [[nodiscard]]
+        explicit ThreadPool(std::size_t const threadCount)
+        {
+            GIMO_ASSERT(0u < threadCount, "ThreadPool requires at least one worker.");
+
+            m_Workers.reserve(threadCount);
+            for (std::size_t i{0u}; i < threadCount; ++i)
+            {
+                m_Workers.emplace_back([this] { run(); });
+            }
+        }
+
+        ~ThreadPool() noexcept
+        {
+            {
+                std::scoped_lock const lock{m_Mutex};
+                m_IsStopped = true;
+            }
+            m_Condition.notify_all();
+
+            for (std::thread& worker : m_Workers)
+            {
+                worker.join();
+            }
+        }
+
+        ThreadPool(ThreadPool const&) = delete;
+        ThreadPool& operator=(ThreadPool const&) = delete;
+        ThreadPool(ThreadPool&&) = delete;
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        /**
+         * \brief Returns an awaitable, which resumes the awaiting coroutine on one of the workers.
+         */
+        [[nodiscard]]
+        auto schedule() noexcept
+        {
+            struct Awaiter
+            {
+                ThreadPool& pool;
+
+                [[nodiscard]]
+                static constexpr bool await_ready() noexcept
+                {
+                    return false;
+                }
+
+                void await_suspend(std::coroutine_handle<> const handle) const
+                {
+                    pool.enqueue(handle);
+                }
+
+                static constexpr void await_resume() noexcept
+                {
+                }
+            };
+
+            return Awaiter{*this};
+        }
+
+    private:
+        std::mutex m_Mutex{};
+        std::condition_variable m_Condition{};
+        std::deque<std::coroutine_handle<>> m_Queue{};
+        bool m_IsStopped{false};
+        std::vector<std::thread> m_Workers{};
+
+        void enqueue(std::coroutine_handle<> const handle)
+        {
+            {
+                std::scoped_lock const lock{m_Mutex};
+                m_Queue.emplace_back(handle);
+            }
+            m_Condition.notify_one();
+        }
+
+        void run()
+        {
+            for (;;)
+            {
+                std::coroutine_handle<> handle{};
+                {
+                    std::unique_lock lock{m_Mutex};
+                    m_Condition.wait(lock, [this] { return m_IsStopped || !m_Queue.empty(); });
+                    if (m_Queue.empty())
+                    {
+                        return;
+                    }
+
+                    handle = m_Queue.front();
+                    m_Queue.pop_front();
+                }
+
+                handle.resume();
+            }
+        }
+    };
+}
+
+#endif
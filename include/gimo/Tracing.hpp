@@ -0,0 +1,444 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_TRACING_HPP
+#define GIMO_TRACING_HPP
+
+#pragma once
+
+#include "gimo/Config.hpp"
+#include "gimo/Instrumentation.hpp"
+#include "gimo/Pipeline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gimo
+{
+    /**
+     * \brief Determines, whether the type can receive the events of a traced pipeline.
+     * \details In addition to the `instrumentation_sink` requirements, the sink is notified when a step returns.
+     */
+    template <typename Sink>
+    concept trace_sink = instrumentation_sink<Sink>
+                      && detail::instrumentation::exit_observing<Sink>;
+
+    /**
+     * \brief The kinds of events, a traced step emits.
+     */
+    enum class TraceEventKind : std::uint8_t
+    {
+        enterValue,
+        enterNull,
+        exit
+    };
+
+    /**
+     * \brief A single event of a traced step.
+     */
+    struct TraceEvent
+    {
+        /**
+         * \brief The time, when the event occurred; relative to the creation of the sink.
+         */
+        std::chrono::nanoseconds timestamp{};
+
+        /**
+         * \brief The zero-based index of the step.
+         */
+        std::uint32_t step{};
+
+        TraceEventKind kind{};
+
+        [[nodiscard]]
+        friend bool operator==(TraceEvent const&, TraceEvent const&) = default;
+    };
+
+    /**
+     * \brief The recorded events of a single thread.
+     */
+    struct ThreadTrace
+    {
+        /**
+         * \brief The index of the thread, in the order the threads emitted their first event.
+         */
+        std::size_t thread{};
+
+        /**
+         * \brief The number of events, which have been overwritten by newer ones.
+         */
+        std::uint64_t dropped{};
+
+        /**
+         * \brief The retained events, oldest first.
+         */
+        std::vector<TraceEvent> events{};
+    };
+
+    /**
+     * \brief A `trace_sink`, which records the events of each thread into a fixed-size ring-buffer.
+     * \tparam Clock The clock, the events are timestamped with.
+     * \details
+     * Each thread writes into its own buffer, thus recording is lock-free and does not allocate (after the first event of a thread).
+     * When a buffer is full, the oldest events are overwritten.
+     *
+     * `collect` must not be called, while a traced pipeline is still running. The sink must outlive all pipelines,
+     * which report into it.
+     */
+    template <typename Clock = std::chrono::steady_clock>
+    class TraceSink
+    {
+    public:
+        using clock_type = Clock;
+
+        /**
+         * \brief Creates a sink, which retains at most `capacity` events per thread.
+         */
+        [[nodiscard]]
+        explicit TraceSink(std::size_t const capacity = 4096u)
+            : m_Capacity{capacity}
+        {
+            GIMO_ASSERT(0u < capacity, "TraceSink requires a non-zero capacity.");
+        }
+
+        TraceSink(TraceSink const&) = delete;
+        TraceSink& operator=(TraceSink const&) = delete;
+        TraceSink(TraceSink&&) = delete;
+        TraceSink& operator=(TraceSink&&) = delete;
+
+        /**
+         * \brief Returns the number of events, which are retained per thread.
+         */
+        [[nodiscard]]
+        std::size_t capacity() const noexcept
+        {
+            return m_Capacity;
+        }
+
+        void on_value(std::size_t const step) noexcept
+        {
+            record(step, TraceEventKind::enterValue);
+        }
+
+        void on_null(std::size_t const step) noexcept
+        {
+            record(step, TraceEventKind::enterNull);
+        }
+
+        void on_exit(std::size_t const step) noexcept
+        {
+            record(step, TraceEventKind::exit);
+        }
+
+        /**
+         * \brief Copies the retained events of all threads.
+         */
+        [[nodiscard]]
+        std::vector<ThreadTrace> collect() const
+        {
+            std::vector<ThreadTrace> traces{};
+            m_Buffers.for_each([&](std::size_t const thread, Buffer const& buffer) {
+                std::uint64_t const head = buffer.head.load(std::memory_order_acquire);
+                std::uint64_t const count = std::min<std::uint64_t>(head, m_Capacity);
+
+                ThreadTrace& trace = traces.emplace_back(ThreadTrace{.thread = thread, .dropped = head - count});
+                trace.events.reserve(static_cast<std::size_t>(count));
+                for (std::uint64_t i{head - count}; i < head; ++i)
+                {
+                    trace.events.emplace_back(buffer.events[static_cast<std::size_t>(i % m_Capacity)]);
+                }
+            });
+
+            return traces;
+        }
+
+    private:
+        struct Buffer
+        {
+            [[nodiscard]]
+            explicit Buffer(std::size_t const capacity)
+                : events{std::make_unique<TraceEvent[]>(capacity)}
+            {
+            }
+
+            std::atomic<std::uint64_t> head{};
+            std::unique_ptr<TraceEvent[]> events;
+        };
+
+        std::size_t m_Capacity;
+        typename Clock::time_point m_Origin{Clock::now()};
+        detail::instrumentation::PerThread<Buffer> m_Buffers{};
+
+        void record(std::size_t const step, TraceEventKind const kind) noexcept
+        {
+            auto const timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_Origin);
+            Buffer& buffer = m_Buffers.local([this] { return std::make_unique<Buffer>(m_Capacity); });
+
+            // The owning thread is the only writer, thus the head is merely published.
+            std::uint64_t const head = buffer.head.load(std::memory_order_relaxed);
+            buffer.events[static_cast<std::size_t>(head % m_Capacity)] = TraceEvent{
+                .timestamp = timestamp,
+                .step = static_cast<std::uint32_t>(step),
+                .kind = kind};
+            buffer.head.store(head + 1u, std::memory_order_release);
+        }
+    };
+
+    namespace detail::tracing
+    {
+        inline void write_json_string(std::ostream& out, std::string_view const str)
+        {
+            constexpr std::string_view hexDigits{"0123456789abcdef"};
+
+            out << '"';
+            for (char const c : str)
+            {
+                if ('"' == c || '\\' == c)
+                {
+                    out << '\\' << c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20u)
+                {
+                    auto const code = static_cast<unsigned char>(c);
+                    out << "\\u00" << hexDigits[code >> 4u] << hexDigits[code & 0xFu];
+                }
+                else
+                {
+                    out << c;
+                }
+            }
+            out << '"';
+        }
+
+        /**
+         * \brief Writes the timestamp in microseconds, as required by the trace-event format.
+         * \details Integer arithmetic is used on purpose, as floating-point output depends on the stream's locale.
+         */
+        inline void write_timestamp(std::ostream& out, std::chrono::nanoseconds const timestamp)
+        {
+            auto const nanoseconds = timestamp.count();
+            auto const fraction = nanoseconds % 1000;
+
+            out << nanoseconds / 1000 << '.'
+                << static_cast<char>('0' + fraction / 100)
+                << static_cast<char>('0' + fraction / 10 % 10)
+                << static_cast<char>('0' + fraction % 10);
+        }
+
+        inline void write_event(
+            std::ostream& out,
+            std::string_view const name,
+            char const phase,
+            std::chrono::nanoseconds const timestamp,
+            std::size_t const thread,
+            std::string_view const branch)
+        {
+            out << "{\"name\":";
+            write_json_string(out, name);
+            out << ",\"cat\":\"gimo\",\"ph\":\"" << phase << "\",\"ts\":";
+            write_timestamp(out, timestamp);
+            out << ",\"pid\":1,\"tid\":" << thread;
+            if (!branch.empty())
+            {
+                out << ",\"args\":{\"branch\":\"" << branch << "\"}";
+            }
+            out << '}';
+        }
+    }
+
+    /**
+     * \brief Writes the traces in the Chrome trace-event format, which is understood by `chrome://tracing` and Perfetto.
+     * \param out The output stream.
+     * \param traces The traces to write; usually obtained via `TraceSink::collect`.
+     * \param stepNames The names of the steps, in pipeline order; unnamed steps are called `step #<index>`.
+     * \param pipelineName The name of the span, which encloses each pipeline application.
+     * \details
+     * Each step is written as a begin/end event pair. The begin event carries the taken branch (`value` or `null`) as argument.
+     *
+     * When events of a thread have been dropped, its leading events up to the first begin of a pipeline application are skipped,
+     * as their counterparts have been overwritten.
+     */
+    inline void write_chrome_trace(
+        std::ostream& out,
+        std::span<ThreadTrace const> const traces,
+        std::span<std::string const> const stepNames = {},
+        std::string_view const pipelineName = "Pipeline::apply")
+    {
+        auto const nameOf = [&](std::uint32_t const step) {
+            return step < stepNames.size()
+                     ? stepNames[step]
+                     : "step #" + std::to_string(step);
+        };
+
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool isFirst{true};
+        auto const emit = [&](std::string_view const name, char const phase, TraceEvent const& event, std::size_t const thread, std::string_view const branch) {
+            out << (std::exchange(isFirst, false) ? "\n" : ",\n");
+            detail::tracing::write_event(out, name, phase, event.timestamp, thread, branch);
+        };
+
+        for (ThreadTrace const& trace : traces)
+        {
+            std::span<TraceEvent const> events{trace.events};
+            if (0u != trace.dropped)
+            {
+                auto const first = std::ranges::find_if(events, [](TraceEvent const& event) {
+                    return 0u == event.step && TraceEventKind::exit != event.kind;
+                });
+                events = events.subspan(static_cast<std::size_t>(first - events.begin()));
+            }
+
+            for (TraceEvent const& event : events)
+            {
+                // The first step encloses all others, thus its span is the span of the whole application.
+                bool const isPipelineBoundary = 0u == event.step;
+                switch (event.kind)
+                {
+                case TraceEventKind::enterValue:
+                    [[fallthrough]];
+                case TraceEventKind::enterNull:
+                    if (isPipelineBoundary)
+                    {
+                        emit(pipelineName, 'B', event, trace.thread, {});
+                    }
+                    emit(nameOf(event.step), 'B', event, trace.thread, TraceEventKind::enterValue == event.kind ? "value" : "null");
+                    break;
+
+                case TraceEventKind::exit:
+                    emit(nameOf(event.step), 'E', event, trace.thread, {});
+                    if (isPipelineBoundary)
+                    {
+                        emit(pipelineName, 'E', event, trace.thread, {});
+                    }
+                    break;
+                }
+            }
+        }
+
+        out << "\n]}\n";
+    }
+
+    /**
+     * \brief A `TraceSink`, which writes its traces into a Chrome trace-event file.
+     * \tparam Clock The clock, the events are timestamped with.
+     * \details
+     * The file is written on `flush` and on destruction, thus it can be inspected offline, e.g. via https://ui.perfetto.dev.
+     * Errors during destruction are silently ignored.
+     */
+    template <typename Clock = std::chrono::steady_clock>
+    class ChromeTraceFileSink
+        : public TraceSink<Clock>
+    {
+    public:
+        /**
+         * \brief Creates a sink, which writes into the file at `path`.
+         * \param path The path of the trace file; an existing file is overwritten.
+         * \param stepNames The names of the steps, in pipeline order.
+         * \param capacity The number of events, which are retained per thread.
+         */
+        [[nodiscard]]
+        explicit ChromeTraceFileSink(
+            std::filesystem::path path,
+            std::vector<std::string> stepNames = {},
+            std::size_t const capacity = 4096u)
+            : TraceSink<Clock>{capacity},
+              m_Path{std::move(path)},
+              m_StepNames{std::move(stepNames)}
+        {
+        }
+
+        ~ChromeTraceFileSink() noexcept
+        {
+            try
+            {
+                flush();
+            }
+            catch (...)
+            {
+            }
+        }
+
+        ChromeTraceFileSink(ChromeTraceFileSink const&) = delete;
+        ChromeTraceFileSink& operator=(ChromeTraceFileSink const&) = delete;
+        ChromeTraceFileSink(ChromeTraceFileSink&&) = delete;
+        ChromeTraceFileSink& operator=(ChromeTraceFileSink&&) = delete;
+
+        /**
+         * \brief Returns the path of the trace file.
+         */
+        [[nodiscard]]
+        std::filesystem::path const& path() const noexcept
+        {
+            return m_Path;
+        }
+
+        /**
+         * \brief (Re-)Writes the trace file with all currently retained events.
+         * \throws std::runtime_error When the file can not be written.
+         */
+        void flush() const
+        {
+            std::ofstream out{m_Path, std::ios::out | std::ios::trunc};
+            if (!out)
+            {
+                throw std::runtime_error{"Unable to open the trace file: " + m_Path.string()};
+            }
+
+            write_chrome_trace(out, this->collect(), m_StepNames);
+            if (!out.flush())
+            {
+                throw std::runtime_error{"Unable to write the trace file: " + m_Path.string()};
+            }
+        }
+
+    private:
+        std::filesystem::path m_Path;
+        std::vector<std::string> m_StepNames;
+    };
+
+    /**
+     * \brief Traces each step of the pipeline into the sink.
+     * \tparam Pipeline The pipeline type.
+     * \tparam Sink The sink type.
+     * \param steps The pipeline to trace.
+     * \param sink The sink, which receives the events. Must outlive the returned pipeline.
+     * \return A pipeline, which performs the very same operations as `steps`.
+     * \details
+     * Each step reports when it's entered, along with the taken branch (value or null), and when it returns.
+     * As each step must be entered to be traced, nulls are no longer fast-forwarded over consecutive steps.
+     *
+     * When `GIMO_TRACE` is defined as `0`, the pipeline is returned as-is; i.e. the result has the very same type
+     * as the input, which guarantees that no overhead remains.
+     */
+    template <pipeline Pipeline, trace_sink Sink>
+    [[nodiscard]]
+    constexpr auto traced(Pipeline&& steps, [[maybe_unused]] Sink& sink)
+    {
+        if constexpr (0 == GIMO_TRACE)
+        {
+            return std::remove_cvref_t<Pipeline>{std::forward<Pipeline>(steps)};
+        }
+        else
+        {
+            return detail::instrumentation::instrument(std::forward<Pipeline>(steps), sink);
+        }
+    }
+}
+
+#endif
@@ -42,6 +42,8 @@ namespace gimo::detail::and_then
     template <typename Action, nullable Nullable>
     [[nodiscard]]
     constexpr result_t<Nullable, Action> on_value(Action&& action, Nullable&& opt)
+        noexcept(std::is_nothrow_invocable_v<Action, value_result_t<Nullable>>
+                 && noexcept(detail::forward_value<Nullable>(opt)))
     {
         return std::invoke(
             std::forward<Action>(action),
@@ -65,6 +67,7 @@ namespace gimo::detail::and_then
     template <typename Action, nullable Nullable>
     [[nodiscard]]
     constexpr result_t<Nullable, Action> on_null([[maybe_unused]] Action&& action, [[maybe_unused]] Nullable&& opt)
+        noexcept(noexcept(detail::construct_empty<result_t<Nullable, Action>>()))
     {
         return detail::construct_empty<result_t<Nullable, Action>>();
     }
@@ -72,29 +75,45 @@ namespace gimo::detail::and_then
     template <typename Action, expected_like Expected>
     [[nodiscard]]
     constexpr result_t<Expected, Action> on_null([[maybe_unused]] Action&& action, Expected&& expected)
+        noexcept(noexcept(detail::rebind_error<result_t<Expected, Action>, Expected>(expected)))
     {
         return detail::rebind_error<result_t<Expected, Action>, Expected>(expected);
     }
 
     template <typename Action, nullable Nullable, typename Next, typename... Steps>
     [[nodiscard]]
-    constexpr auto on_null(Action&& action, Nullable&& opt, Next&& next, Steps&&... steps)
+    constexpr auto on_null([[maybe_unused]] Action&& action, Nullable&& opt, Next&& next, Steps&&... steps)
     {
-        return std::forward<Next>(next).on_null(
-            and_then::on_null(std::forward<Action>(action), std::forward<Nullable>(opt)),
+        return detail::propagate_null<result_t<Nullable, Action>>(
+            std::forward<Nullable>(opt),
+            std::forward<Next>(next),
             std::forward<Steps>(steps)...);
     }
 
     struct traits
     {
+        template <nullable Nullable, typename Action>
+        using result_t = and_then::result_t<Nullable, Action>;
+
+        template <nullable Nullable, typename Action>
+        using null_result_t = and_then::result_t<Nullable, Action>;
+
         template <nullable Nullable, typename Action>
         static constexpr bool is_applicable_on = requires {
             requires nullable<result_t<Nullable, Action>>;
         };
 
+        template <nullable Nullable, typename Action>
+        static constexpr bool is_nothrow_applicable_on = requires(Action&& action, Nullable&& opt) {
+            requires is_applicable_on<Nullable, Action>;
+            { and_then::on_value(std::forward<Action>(action), std::forward<Nullable>(opt)) } noexcept;
+            { and_then::on_null(std::forward<Action>(action), std::forward<Nullable>(opt)) } noexcept;
+        };
+
         template <typename Action, nullable Nullable, typename... Steps>
         [[nodiscard]]
         static constexpr auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
+            noexcept(detail::is_nothrow_step<traits, Action, Nullable, Steps...>::value)
         {
             if constexpr (is_applicable_on<Nullable, Action>)
             {
@@ -112,6 +131,7 @@ namespace gimo::detail::and_then
         template <typename Action, nullable Nullable, typename... Steps>
         [[nodiscard]]
         static constexpr auto on_null(Action&& action, Nullable&& opt, Steps&&... steps)
+            noexcept(detail::is_nothrow_step<traits, Action, Nullable, Steps...>::value)
         {
             if constexpr (is_applicable_on<Nullable, Action>)
             {
@@ -0,0 +1,242 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_ALGORITHM_AND_THEN_ASYNC_HPP
+#define GIMO_ALGORITHM_AND_THEN_ASYNC_HPP
+
+#pragma once
+
+#include "gimo/Common.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo/Task.hpp"
+#include "gimo/algorithm/BasicAlgorithm.hpp"
+
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace gimo::detail::and_then_async
+{
+    template <typename Awaitable>
+    constexpr decltype(auto) get_awaiter(Awaitable&& awaitable)
+    {
+        if constexpr (requires { std::forward<Awaitable>(awaitable).operator co_await(); })
+        {
+            return std::forward<Awaitable>(awaitable).operator co_await();
+        }
+        else if constexpr (requires { operator co_await(std::forward<Awaitable>(awaitable)); })
+        {
+            return operator co_await(std::forward<Awaitable>(awaitable));
+        }
+        else
+        {
+            return std::forward<Awaitable>(awaitable);
+        }
+    }
+
+    template <typename Awaitable>
+    concept awaitable = requires(Awaitable&& awaitable) {
+        { and_then_async::get_awaiter(std::forward<Awaitable>(awaitable)).await_ready() } -> std::convertible_to<bool>;
+        and_then_async::get_awaiter(std::forward<Awaitable>(awaitable)).await_resume();
+    };
+
+    template <awaitable Awaitable>
+    using await_result_t = decltype(and_then_async::get_awaiter(std::declval<Awaitable>()).await_resume());
+
+    template <typename T>
+    struct unwrap_task
+    {
+        using type = T;
+    };
+
+    template <typename T>
+    struct unwrap_task<Task<T>>
+    {
+        using type = T;
+    };
+
+    template <typename Nullable, typename... Steps>
+    struct chain_result
+    {
+        using type = Nullable;
+    };
+
+    template <typename Nullable, typename First, typename... Rest>
+    struct chain_result<Nullable, First, Rest...>
+    {
+        using type = typename unwrap_task<std::invoke_result_t<First, Nullable, Rest...>>::type;
+    };
+
+    template <typename Nullable, typename Action>
+    consteval Nullable* print_diagnostics()
+    {
+        if constexpr (!std::is_invocable_v<Action, value_result_t<Nullable>>)
+        {
+            static_assert(always_false_v<Nullable>, "The and_then_async algorithm requires an action invocable with the nullable's value.");
+        }
+        else if constexpr (!awaitable<std::invoke_result_t<Action, value_result_t<Nullable>>>)
+        {
+            static_assert(always_false_v<Nullable>, "The and_then_async algorithm requires an action with an awaitable return-type.");
+        }
+        else if constexpr (!nullable<std::remove_cvref_t<await_result_t<std::invoke_result_t<Action, value_result_t<Nullable>>>>>)
+        {
+            static_assert(always_false_v<Nullable>, "The and_then_async algorithm requires an awaitable, which results in a nullable.");
+        }
+
+        return nullptr;
+    }
+
+    template <typename Nullable, typename Action>
+    using result_t = std::remove_cvref_t<
+        await_result_t<std::invoke_result_t<Action, value_result_t<Nullable>>>>;
+
+    template <typename Result, typename Nullable, typename... Steps>
+    [[nodiscard]]
+    Task<Result> finish(Nullable&& opt, Steps&&... steps)
+    {
+        if constexpr (0u == sizeof...(Steps))
+        {
+            return Task<Result>{std::forward<Nullable>(opt)};
+        }
+        else
+        {
+            return [&]<typename First, typename... Rest>(First&& first, Rest&&... rest) {
+                auto result = std::invoke(std::forward<First>(first), std::forward<Nullable>(opt), std::forward<Rest>(rest)...);
+                if constexpr (std::same_as<Task<Result>, decltype(result)>)
+                {
+                    return result;
+                }
+                else
+                {
+                    return Task<Result>{std::move(result)};
+                }
+            }(std::forward<Steps>(steps)...);
+        }
+    }
+
+    /**
+     * \brief Awaits the awaitable and continues with the remaining steps.
+     * \details The steps are stored by value, thus the pipeline is not required to outlive the task.
+     */
+    template <typename Result, typename Awaitable, typename... Steps>
+    [[nodiscard]]
+    Task<Result> resume(Awaitable awaitable, Steps... steps)
+    {
+        co_return co_await and_then_async::finish<Result>(
+            co_await std::move(awaitable),
+            std::move(steps)...);
+    }
+
+    template <typename Action, nullable Nullable, typename... Steps>
+    [[nodiscard]]
+    auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
+    {
+        using Next = result_t<Nullable, Action>;
+        using Result = typename chain_result<Next, std::remove_cvref_t<Steps>...>::type;
+
+        return and_then_async::resume<Result>(
+            std::invoke(std::forward<Action>(action), detail::forward_value<Nullable>(opt)),
+            std::forward<Steps>(steps)...);
+    }
+
+    template <typename Action, nullable Nullable, typename... Steps>
+    [[nodiscard]]
+    auto on_null([[maybe_unused]] Action&& action, Nullable&& opt, Steps&&... steps)
+    {
+        using Next = result_t<Nullable, Action>;
+        using Result = typename chain_result<Next, std::remove_cvref_t<Steps>...>::type;
+
+        return and_then_async::finish<Result>(
+            detail::propagate_null<Next>(std::forward<Nullable>(opt), std::forward<Steps>(steps)...));
+    }
+
+    struct traits
+    {
+        template <nullable Nullable, typename Action>
+        using next_input_t = and_then_async::result_t<Nullable, Action>;
+
+        template <nullable Nullable, typename Action>
+        static constexpr bool is_applicable_on = requires {
+            requires std::is_invocable_v<Action, value_result_t<Nullable>>;
+            requires awaitable<std::invoke_result_t<Action, value_result_t<Nullable>>>;
+            requires nullable<result_t<Nullable, Action>>;
+        };
+
+        template <nullable Nullable, typename Action>
+        static constexpr bool is_nothrow_applicable_on = false;
+
+        template <typename Action, nullable Nullable, typename... Steps>
+        [[nodiscard]]
+        static constexpr auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
+        {
+            if constexpr (is_applicable_on<Nullable, Action>)
+            {
+                return and_then_async::on_value(
+                    std::forward<Action>(action),
+                    std::forward<Nullable>(opt),
+                    std::forward<Steps>(steps)...);
+            }
+            else
+            {
+                return *and_then_async::print_diagnostics<Nullable, Action>();
+            }
+        }
+
+        template <typename Action, nullable Nullable, typename... Steps>
+        [[nodiscard]]
+        static constexpr auto on_null(Action&& action, Nullable&& opt, Steps&&... steps)
+        {
+            if constexpr (is_applicable_on<Nullable, Action>)
+            {
+                return and_then_async::on_null(
+                    std::forward<Action>(action),
+                    std::forward<Nullable>(opt),
+                    std::forward<Steps>(steps)...);
+            }
+            else
+            {
+                return *and_then_async::print_diagnostics<Nullable, Action>();
+            }
+        }
+    };
+}
+
+namespace gimo
+{
+    namespace detail
+    {
+        template <typename Action>
+        using and_then_async_t = BasicAlgorithm<and_then_async::traits, std::remove_cvref_t<Action>>;
+    }
+
+    /**
+     * \brief Creates a pipeline step that applies a function returning an awaitable of a nullable type.
+     * \ingroup ALGORITHM
+     * \tparam Action The action type.
+     * \param action A unary operation.
+     * \return A Pipeline step containing the `and_then_async` algorithm.
+     * \details
+     * - **On Value**: Invokes the `action` with the underlying value of the input.
+     * The `action` **must** return an awaitable (e.g. `gimo::Task`), which results in a `nullable` type.
+     * The remaining steps of the pipeline are executed, once that awaitable completes, and on the thread which completed it.
+     * - **On Null**: Propagates the null (or error) state immediately (i.e., `action` is not executed).
+     * The remaining steps are executed synchronously.
+     *
+     * Either way, applying a pipeline, which contains this step, results in a `gimo::Task` of the final nullable.
+     * That task must be awaited (or passed to `gimo::sync_wait`) to obtain the result.
+     * The remaining steps are copied into the task, thus the pipeline is not required to outlive it.
+     */
+    template <typename Action>
+    [[nodiscard]]
+    constexpr auto and_then_async(Action&& action)
+    {
+        using Algorithm = detail::and_then_async_t<Action>;
+
+        return Pipeline{std::tuple<Algorithm>{std::forward<Action>(action)}};
+    }
+}
+
+#endif
@@ -12,6 +12,8 @@
 #include "gimo/Config.hpp"
 
 #include <concepts>
+#include <cstddef>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -24,26 +26,218 @@ namespace gimo
 
     namespace detail
     {
+        template <typename Nullable, typename Traits, typename Action>
+        concept applicable_to_impl = Traits::template is_applicable_on<Nullable, Action>;
+
+        template <typename Traits, typename Nullable, typename Action>
+        concept null_propagating = requires {
+            requires Traits::template is_applicable_on<Nullable, Action>;
+            typename Traits::template null_result_t<Nullable, Action>;
+        };
+
+        template <typename Source, typename Target>
+        concept null_state_transferable =
+            (expected_like<Source>
+             && expected_like<Target>
+             && std::same_as<
+                 std::remove_cvref_t<error_result_t<Source>>,
+                 std::remove_cvref_t<error_result_t<Target>>>)
+            || (!expected_like<Source> && !expected_like<Target>);
+
+        template <typename Step>
+        using step_traits_t = typename std::remove_cvref_t<Step>::traits_type;
+
+        template <typename Step>
+        using step_action_t = const_ref_like_t<Step, typename std::remove_cvref_t<Step>::action_type>;
+
+        template <typename Step, typename Nullable>
+        using step_null_result_t = typename step_traits_t<Step>::template null_result_t<Nullable, step_action_t<Step>>;
+
+        /**
+         * \brief Determines the nullable type, which the `Step` hands over to its subsequent step.
+         * \details
+         * This is the result of invoking the step on its own, unless its traits declare a `next_input_t` alias-template.
+         * The latter is required for steps, which do not return the nullable directly (e.g. asynchronous ones).
+         */
+        template <typename Step, typename Nullable>
+        struct step_next_input
+        {
+            using type = std::invoke_result_t<Step, Nullable>;
+        };
+
+        template <typename Step, typename Nullable>
+            requires requires { typename step_traits_t<Step>::template next_input_t<Nullable, step_action_t<Step>>; }
+        struct step_next_input<Step, Nullable>
+        {
+            using type = typename step_traits_t<Step>::template next_input_t<Nullable, step_action_t<Step>>;
+        };
+
+        template <typename Step, typename Nullable>
+        using step_next_input_t = typename step_next_input<Step, Nullable>::type;
+
+        /**
+         * \brief Determines how many of the leading `Steps` merely propagate the null-state of `Source`.
+         * \details
+         * A step is skippable, if its traits declare a `null_result_t` (i.e. it does nothing but forwarding the null-state)
+         * and constructing its result directly from `Source` yields the very same outcome as walking the whole chain.
+         * The latter holds for nullables without any payload and for expected-likes which keep the error-type unchanged.
+         */
+        template <typename Source, typename Nullable, typename... Steps>
+        struct null_propagation
+        {
+            using type = Nullable;
+            static constexpr std::size_t skipped{0u};
+        };
+
+        template <typename Source, typename Nullable, typename First, typename... Rest>
+            requires null_propagating<step_traits_t<First>, Nullable, step_action_t<First>>
+                  && null_state_transferable<Source, step_null_result_t<First, Nullable>>
+        struct null_propagation<Source, Nullable, First, Rest...>
+        {
+            using next = null_propagation<Source, step_null_result_t<First, Nullable>, Rest...>;
+            using type = typename next::type;
+            static constexpr std::size_t skipped{1u + next::skipped};
+        };
+
+        template <typename Target, typename Source>
+        consteval bool is_nothrow_null_constructible_from()
+        {
+            if constexpr (expected_like<Source>)
+            {
+                return noexcept(detail::rebind_error<Target, Source>(std::declval<std::remove_reference_t<Source>&>()));
+            }
+            else
+            {
+                return noexcept(detail::construct_empty<Target>());
+            }
+        }
+
+        template <nullable Target, typename Source>
+        [[nodiscard]]
+        constexpr Target construct_null_from(Source&& source)
+            noexcept(is_nothrow_null_constructible_from<Target, Source>())
+        {
+            if constexpr (expected_like<Source>)
+            {
+                return detail::rebind_error<Target, Source>(source);
+            }
+            else
+            {
+                return detail::construct_empty<Target>();
+            }
+        }
+
+        /**
+         * \brief Fast-forwards the null-state of `source` over all subsequent steps, which would merely propagate it.
+         * \tparam Nullable The result-type of the current step.
+         * \details
+         * Instead of materializing an empty intermediate for each step, the result of the last skippable step is
+         * directly constructed from `source`. If there are remaining steps, the first of them is continued via its `on_null`.
+         */
+        template <nullable Nullable, typename Source, typename... Steps>
+        [[nodiscard]]
+        constexpr auto propagate_null(Source&& source, Steps&&... steps)
+        {
+            using propagation = null_propagation<Source, Nullable, Steps...>;
+            using Target = typename propagation::type;
+
+            if constexpr (propagation::skipped == sizeof...(Steps))
+            {
+                return detail::construct_null_from<Target>(std::forward<Source>(source));
+            }
+            else
+            {
+                return [&]<std::size_t... indices>([[maybe_unused]] std::index_sequence<indices...> const) {
+                    auto stepRefs = std::forward_as_tuple(std::forward<Steps>(steps)...);
+
+                    return std::get<propagation::skipped>(std::move(stepRefs))
+                        .on_null(
+                            detail::construct_null_from<Target>(std::forward<Source>(source)),
+                            std::get<propagation::skipped + 1u + indices>(std::move(stepRefs))...);
+                }(std::make_index_sequence<sizeof...(Steps) - propagation::skipped - 1u>{});
+            }
+        }
+
+        template <typename Traits, typename Action, typename Nullable, typename... Steps>
+        consteval bool is_nothrow_null_propagation()
+        {
+            if constexpr (0u < sizeof...(Steps) && null_propagating<Traits, Nullable, Action>)
+            {
+                using Target = typename null_propagation<
+                    Nullable,
+                    typename Traits::template null_result_t<Nullable, Action>,
+                    Steps...>::type;
+
+                return noexcept(detail::construct_null_from<Target>(std::declval<Nullable>()));
+            }
+            else
+            {
+                return true;
+            }
+        }
+
+        template <typename Traits, typename Action, typename Nullable, typename... Steps>
+        struct is_nothrow_step
+            : public std::false_type
+        {
+        };
+
+        /**
+         * \brief Determines, whether the `Steps` process the `Nullable` without emitting any exception.
+         * \details Each step is inspected for both, the value- and the null-case, as only the input decides at runtime.
+         */
+        template <typename Nullable, typename... Steps>
+        struct is_nothrow_processable_impl
+            : public std::bool_constant<0u == sizeof...(Steps)>
+        {
+        };
+
+        template <typename Nullable, typename First, typename... Rest>
+        struct is_nothrow_processable_impl<Nullable, First, Rest...>
+            : public is_nothrow_step<step_traits_t<First>, step_action_t<First>, Nullable, Rest...>
+        {
+        };
+
+        template <typename Traits, typename Action, typename Nullable, typename... Steps>
+            requires Traits::template is_nothrow_applicable_on<Nullable, Action>
+        struct is_nothrow_step<Traits, Action, Nullable, Steps...>
+            : public std::bool_constant<
+                  noexcept(detail::has_value(std::declval<Nullable const&>()))
+                  && is_nothrow_null_propagation<Traits, Action, Nullable, Steps...>()
+                  && is_nothrow_processable_impl<typename Traits::template result_t<Nullable, Action>, Steps...>::value>
+        {
+        };
+
         template <typename Traits, typename Action, typename Nullable, typename... Steps>
         [[nodiscard]]
         static constexpr auto test_and_execute(Action&& action, Nullable&& opt, Steps&&... steps)
+            noexcept(is_nothrow_step<Traits, Action, Nullable, Steps...>::value)
         {
-            if (detail::has_value(opt))
+            if constexpr (always_engaged<Nullable>)
             {
+                GIMO_ASSERT(detail::has_value(opt), "Always engaged nullable must contain a value.", opt);
+
                 return Traits::on_value(
                     std::forward<Action>(action),
                     std::forward<Nullable>(opt),
                     std::forward<Steps>(steps)...);
             }
-
-            return Traits::on_null(
-                std::forward<Action>(action),
-                std::forward<Nullable>(opt),
-                std::forward<Steps>(steps)...);
+            else
+            {
+                if (detail::has_value(opt))
+                {
+                    return Traits::on_value(
+                        std::forward<Action>(action),
+                        std::forward<Nullable>(opt),
+                        std::forward<Steps>(steps)...);
+                }
+
+                return Traits::on_null(
+                    std::forward<Action>(action),
+                    std::forward<Nullable>(opt),
+                    std::forward<Steps>(steps)...);
+            }
         }
-
-        template <typename Nullable, typename Traits, typename Action>
-        concept applicable_to_impl = Traits::template is_applicable_on<Nullable, Action>;
     }
 
     /**
@@ -60,6 +254,22 @@ namespace gimo
             detail::const_ref_like_t<Algorithm, typename std::remove_cvref_t<Algorithm>::action_type>>;
     };
 
+    /**
+     * \brief Evaluates whether the specific `Algorithm` processes a `Nullable` without emitting any exception.
+     * \ingroup ALGORITHM
+     * \tparam Nullable The nullable type.
+     * \tparam Algorithm The monadic operation to be performed.
+     * \details
+     * The traits of the algorithm must declare the `is_nothrow_applicable_on` variable-template and the `result_t` alias-template.
+     * Otherwise, the algorithm is conservatively considered to be potentially throwing.
+     */
+    template <typename Nullable, typename Algorithm>
+    concept nothrow_applicable_to = applicable_to<Nullable, Algorithm>
+                                 && detail::is_nothrow_step<
+                                     typename std::remove_cvref_t<Algorithm>::traits_type,
+                                     detail::const_ref_like_t<Algorithm, typename std::remove_cvref_t<Algorithm>::action_type>,
+                                     Nullable>::value;
+
     /**
      * \brief The basic building block for every monadic operation.
      * \ingroup ALGORITHM
@@ -76,6 +286,13 @@ namespace gimo
         using traits_type = Traits;
         using action_type = Action;
 
+        /**
+         * \brief Default-constructs the action.
+         * \details This is trivial for stateless actions, which permits pipelines to omit storing them.
+         */
+        [[nodiscard]]
+        BasicAlgorithm() = default;
+
         template <typename... Args>
             requires std::constructible_from<Action, Args&&...>
         [[nodiscard]] //
@@ -87,6 +304,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto operator()(Nullable&& opt, Steps&&... steps) &
+            noexcept(detail::is_nothrow_step<Traits, Action&, Nullable, Steps...>::value)
         {
             return detail::test_and_execute<Traits>(
                 m_Action,
@@ -97,6 +315,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto operator()(Nullable&& opt, Steps&&... steps) const&
+            noexcept(detail::is_nothrow_step<Traits, Action const&, Nullable, Steps...>::value)
         {
             return detail::test_and_execute<Traits>(
                 m_Action,
@@ -107,6 +326,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto operator()(Nullable&& opt, Steps&&... steps) &&
+            noexcept(detail::is_nothrow_step<Traits, Action&&, Nullable, Steps...>::value)
         {
             return detail::test_and_execute<Traits>(
                 std::move(m_Action),
@@ -117,6 +337,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto operator()(Nullable&& opt, Steps&&... steps) const&&
+            noexcept(detail::is_nothrow_step<Traits, Action const&&, Nullable, Steps...>::value)
         {
             return detail::test_and_execute<Traits>(
                 std::move(m_Action),
@@ -127,6 +348,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto on_value(Nullable&& opt, Steps&&... steps) &
+            noexcept(detail::is_nothrow_step<Traits, Action&, Nullable, Steps...>::value)
         {
             GIMO_ASSERT(detail::has_value(opt), "Nullable must contain a value.", opt);
 
@@ -139,6 +361,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto on_value(Nullable&& opt, Steps&&... steps) const&
+            noexcept(detail::is_nothrow_step<Traits, Action const&, Nullable, Steps...>::value)
         {
             GIMO_ASSERT(detail::has_value(opt), "Nullable must contain a value.", opt);
 
@@ -151,6 +374,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto on_value(Nullable&& opt, Steps&&... steps) &&
+            noexcept(detail::is_nothrow_step<Traits, Action&&, Nullable, Steps...>::value)
         {
             GIMO_ASSERT(detail::has_value(opt), "Nullable must contain a value.", opt);
 
@@ -163,6 +387,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto on_value(Nullable&& opt, Steps&&... steps) const&&
+            noexcept(detail::is_nothrow_step<Traits, Action const&&, Nullable, Steps...>::value)
         {
             GIMO_ASSERT(detail::has_value(opt), "Nullable must contain a value.", opt);
 
@@ -175,6 +400,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto on_null(Nullable&& opt, Steps&&... steps) &
+            noexcept(detail::is_nothrow_step<Traits, Action&, Nullable, Steps...>::value)
         {
             GIMO_ASSERT(!detail::has_value(opt), "Nullable must not contain a value.", opt);
 
@@ -187,6 +413,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto on_null(Nullable&& opt, Steps&&... steps) const&
+            noexcept(detail::is_nothrow_step<Traits, Action const&, Nullable, Steps...>::value)
         {
             GIMO_ASSERT(!detail::has_value(opt), "Nullable must not contain a value.", opt);
 
@@ -199,6 +426,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto on_null(Nullable&& opt, Steps&&... steps) &&
+            noexcept(detail::is_nothrow_step<Traits, Action&&, Nullable, Steps...>::value)
         {
             GIMO_ASSERT(!detail::has_value(opt), "Nullable must not contain a value.", opt);
 
@@ -211,6 +439,7 @@ namespace gimo
         template <typename Nullable, typename... Steps>
         [[nodiscard]]
         constexpr auto on_null(Nullable&& opt, Steps&&... steps) const&&
+            noexcept(detail::is_nothrow_step<Traits, Action const&&, Nullable, Steps...>::value)
         {
             GIMO_ASSERT(!detail::has_value(opt), "Nullable must not contain a value.", opt);
 
@@ -221,7 +450,7 @@ namespace gimo
         }
 
     private:
-        [[no_unique_address]] Action m_Action;
+        GIMO_NO_UNIQUE_ADDRESS Action m_Action;
     };
 }
 
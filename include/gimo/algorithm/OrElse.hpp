@@ -38,6 +38,7 @@ namespace gimo::detail::or_else
     template <typename Action, nullable Nullable>
     [[nodiscard]]
     constexpr std::remove_cvref_t<Nullable> on_value([[maybe_unused]] Action&& action, Nullable&& opt)
+        noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<Nullable>, Nullable&&>)
     {
         return std::forward<Nullable>(opt);
     }
@@ -58,6 +59,8 @@ namespace gimo::detail::or_else
     template <typename Action, nullable Nullable>
     [[nodiscard]]
     constexpr std::remove_cvref_t<Nullable> on_null(Action&& action, [[maybe_unused]] Nullable&& opt)
+        noexcept(std::is_nothrow_invocable_v<Action>
+                 && std::is_nothrow_constructible_v<std::remove_cvref_t<Nullable>, std::invoke_result_t<Action>>)
     {
         return std::invoke(std::forward<Action>(action));
     }
@@ -74,6 +77,9 @@ namespace gimo::detail::or_else
 
     struct traits
     {
+        template <nullable Nullable, typename Action>
+        using result_t = std::remove_cvref_t<Nullable>;
+
         template <nullable Nullable, typename Action>
         static constexpr bool is_applicable_on = requires {
             requires std::same_as<
@@ -81,9 +87,17 @@ namespace gimo::detail::or_else
                 std::remove_cvref_t<std::invoke_result_t<Action>>>;
         };
 
+        template <nullable Nullable, typename Action>
+        static constexpr bool is_nothrow_applicable_on = requires(Action&& action, Nullable&& opt) {
+            requires is_applicable_on<Nullable, Action>;
+            { or_else::on_value(std::forward<Action>(action), std::forward<Nullable>(opt)) } noexcept;
+            { or_else::on_null(std::forward<Action>(action), std::forward<Nullable>(opt)) } noexcept;
+        };
+
         template <typename Action, nullable Nullable, typename... Steps>
         [[nodiscard]]
         static constexpr auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
+            noexcept(detail::is_nothrow_step<traits, Action, Nullable, Steps...>::value)
         {
             if constexpr (is_applicable_on<Nullable, Action>)
             {
@@ -101,6 +115,7 @@ namespace gimo::detail::or_else
         template <typename Action, nullable Nullable, typename... Steps>
         [[nodiscard]]
         static constexpr auto on_null(Action&& action, Nullable&& opt, Steps&&... steps)
+            noexcept(detail::is_nothrow_step<traits, Action, Nullable, Steps...>::value)
         {
             if constexpr (is_applicable_on<Nullable, Action>)
             {
@@ -39,11 +39,61 @@ namespace gimo::detail::transform
         Nullable,
         std::invoke_result_t<Action, value_result_t<Nullable>>>;
 
+    /**
+     * \brief Determines, whether the result of the action can be assigned to the value of the (rvalue) input.
+     */
+    template <typename Nullable, typename Action>
+    concept in_place_applicable = !std::is_reference_v<Nullable>
+                               && !std::is_const_v<Nullable>
+                               && value_owning<Nullable>
+                               && std::same_as<Nullable, result_t<Nullable, Action>>
+                               && std::is_assignable_v<
+                                      value_result_t<Nullable&>,
+                                      std::invoke_result_t<Action, value_result_t<Nullable>>>;
+
+    template <typename Nullable, typename Action>
+    consteval bool is_nothrow_on_value()
+    {
+        using Value = std::invoke_result_t<Action, value_result_t<Nullable>>;
+        constexpr bool nothrowConstructible =
+            std::is_nothrow_invocable_v<Action, value_result_t<Nullable>>
+            && noexcept(detail::forward_value<Nullable>(std::declval<std::remove_reference_t<Nullable>&>()))
+            && noexcept(construct_from_value_like<Value>(std::declval<Nullable const&>(), std::declval<Value>()));
+
+        if constexpr (in_place_applicable<Nullable, Action>)
+        {
+            return nothrowConstructible
+                && noexcept(detail::owns_value(std::declval<Nullable const&>()))
+                && noexcept(detail::value(std::declval<Nullable&>()))
+                && std::is_nothrow_assignable_v<value_result_t<Nullable&>, Value>
+                && std::is_nothrow_move_constructible_v<Nullable>;
+        }
+        else
+        {
+            return nothrowConstructible;
+        }
+    }
+
     template <typename Action, nullable Nullable>
     [[nodiscard]]
     constexpr result_t<Nullable, Action> on_value([[maybe_unused]] Action&& action, Nullable&& opt)
+        noexcept(is_nothrow_on_value<Nullable, Action>())
     {
-        return construct_from_value<result_t<Nullable, Action>>(
+        if constexpr (in_place_applicable<Nullable, Action>)
+        {
+            if (detail::owns_value(opt))
+            {
+                decltype(auto) value = detail::value(opt);
+                value = std::invoke(
+                    std::forward<Action>(action),
+                    detail::forward_value<Nullable>(opt));
+
+                return std::move(opt);
+            }
+        }
+
+        return construct_from_value_like<std::invoke_result_t<Action, value_result_t<Nullable>>>(
+            opt,
             std::invoke(
                 std::forward<Action>(action),
                 detail::forward_value<Nullable>(opt)));
@@ -65,6 +115,7 @@ namespace gimo::detail::transform
     template <typename Action, nullable Nullable>
     [[nodiscard]]
     constexpr result_t<Nullable, Action> on_null([[maybe_unused]] Action&& action, [[maybe_unused]] Nullable&& opt)
+        noexcept(noexcept(detail::construct_empty<result_t<Nullable, Action>>()))
     {
         return detail::construct_empty<result_t<Nullable, Action>>();
     }
@@ -72,21 +123,29 @@ namespace gimo::detail::transform
     template <typename Action, expected_like Expected>
     [[nodiscard]]
     constexpr result_t<Expected, Action> on_null([[maybe_unused]] Action&& action, Expected&& expected)
+        noexcept(noexcept(detail::rebind_error<result_t<Expected, Action>, Expected>(expected)))
     {
         return detail::rebind_error<result_t<Expected, Action>, Expected>(expected);
     }
 
     template <nullable Nullable, typename Action, typename Next, typename... Steps>
     [[nodiscard]]
-    constexpr auto on_null(Action&& action, Nullable&& opt, Next&& next, Steps&&... steps)
+    constexpr auto on_null([[maybe_unused]] Action&& action, Nullable&& opt, Next&& next, Steps&&... steps)
     {
-        return std::forward<Next>(next).on_null(
-            transform::on_null(std::forward<Action>(action), std::forward<Nullable>(opt)),
+        return detail::propagate_null<result_t<Nullable, Action>>(
+            std::forward<Nullable>(opt),
+            std::forward<Next>(next),
             std::forward<Steps>(steps)...);
     }
 
     struct traits
     {
+        template <nullable Nullable, typename Action>
+        using result_t = transform::result_t<Nullable, Action>;
+
+        template <nullable Nullable, typename Action>
+        using null_result_t = transform::result_t<Nullable, Action>;
+
         template <nullable Nullable, typename Action>
         static constexpr bool is_applicable_on = requires {
             requires rebindable_value_to<
@@ -94,9 +153,17 @@ namespace gimo::detail::transform
                 std::invoke_result_t<Action, value_result_t<Nullable>>>;
         };
 
+        template <nullable Nullable, typename Action>
+        static constexpr bool is_nothrow_applicable_on = requires(Action&& action, Nullable&& opt) {
+            requires is_applicable_on<Nullable, Action>;
+            { transform::on_value(std::forward<Action>(action), std::forward<Nullable>(opt)) } noexcept;
+            { transform::on_null(std::forward<Action>(action), std::forward<Nullable>(opt)) } noexcept;
+        };
+
         template <typename Action, nullable Nullable, typename... Steps>
         [[nodiscard]]
         static constexpr auto on_value(Action&& action, Nullable&& opt, Steps&&... steps)
+            noexcept(detail::is_nothrow_step<traits, Action, Nullable, Steps...>::value)
         {
             if constexpr (is_applicable_on<Nullable, Action>)
             {
@@ -114,6 +181,7 @@ namespace gimo::detail::transform
         template <typename Action, nullable Nullable, typename... Steps>
         [[nodiscard]]
         static constexpr auto on_null(Action&& action, Nullable&& opt, Steps&&... steps)
+            noexcept(detail::is_nothrow_step<traits, Action, Nullable, Steps...>::value)
         {
             if constexpr (is_applicable_on<Nullable, Action>)
             {
@@ -46,6 +46,7 @@ namespace gimo::detail::transform_error
     template <typename Action, expected_like Expected>
     [[nodiscard]]
     constexpr result_t<Expected, Action> on_value([[maybe_unused]] Action&& action, Expected&& closure)
+        noexcept(noexcept(detail::rebind_value<result_t<Expected, Action>, Expected>(closure)))
     {
         return detail::rebind_value<result_t<Expected, Action>, Expected>(closure);
     }
@@ -66,6 +67,10 @@ namespace gimo::detail::transform_error
     template <typename Action, expected_like Expected>
     [[nodiscard]]
     constexpr result_t<Expected, Action> on_null(Action&& action, Expected&& closure)
+        noexcept(std::is_nothrow_invocable_v<Action, error_result_t<Expected>>
+                 && noexcept(detail::forward_error<Expected>(closure))
+                 && noexcept(detail::construct_from_error<result_t<Expected, Action>>(
+                     std::declval<std::invoke_result_t<Action, error_result_t<Expected>>>())))
     {
         return detail::construct_from_error<result_t<Expected, Action>>(
             std::invoke(
@@ -84,6 +89,9 @@ namespace gimo::detail::transform_error
 
     struct traits
     {
+        template <nullable Expected, typename Action>
+        using result_t = transform_error::result_t<Expected, Action>;
+
         template <nullable Expected, typename Action>
         static constexpr bool is_applicable_on = requires {
             requires rebindable_error_to<
@@ -91,9 +99,17 @@ namespace gimo::detail::transform_error
                 std::invoke_result_t<Action, error_result_t<Expected>>>;
         };
 
+        template <nullable Expected, typename Action>
+        static constexpr bool is_nothrow_applicable_on = requires(Action&& action, Expected&& closure) {
+            requires is_applicable_on<Expected, Action>;
+            { transform_error::on_value(std::forward<Action>(action), std::forward<Expected>(closure)) } noexcept;
+            { transform_error::on_null(std::forward<Action>(action), std::forward<Expected>(closure)) } noexcept;
+        };
+
         template <typename Action, nullable Expected, typename... Steps>
         [[nodiscard]]
         static constexpr auto on_value(Action&& action, Expected&& closure, Steps&&... steps)
+            noexcept(detail::is_nothrow_step<traits, Action, Expected, Steps...>::value)
         {
             if constexpr (is_applicable_on<Expected, Action>)
             {
@@ -111,6 +127,7 @@ namespace gimo::detail::transform_error
         template <typename Action, nullable Expected, typename... Steps>
         [[nodiscard]]
         static constexpr auto on_null(Action&& action, Expected&& closure, Steps&&... steps)
+            noexcept(detail::is_nothrow_step<traits, Action, Expected, Steps...>::value)
         {
             if constexpr (is_applicable_on<Expected, Action>)
             {
@@ -15,6 +15,7 @@
 #include <concepts>
 #include <functional>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace gimo::detail::value_or_else
@@ -33,18 +34,40 @@ namespace gimo::detail::value_or_else
         return nullptr;
     }
 
+    template <typename Nullable>
+    inline constexpr bool is_nothrow_on_value =
+        noexcept(detail::forward_value<Nullable>(std::declval<std::remove_reference_t<Nullable>&>()))
+        && std::is_nothrow_constructible_v<result_t<Nullable>, value_result_t<Nullable>>;
+
+    template <typename Nullable, typename Action>
+    inline constexpr bool is_nothrow_on_null = requires {
+        requires std::is_nothrow_invocable_v<Action>;
+        requires std::is_nothrow_convertible_v<std::invoke_result_t<Action>, result_t<Nullable>>;
+    };
+
     struct traits
     {
+        template <nullable Nullable, typename Action>
+        using result_t = value_or_else::result_t<Nullable>;
+
         template <nullable Nullable, typename Action>
         static constexpr bool is_applicable_on = requires {
             requires std::convertible_to<
                 std::invoke_result_t<Action>,
-                result_t<Nullable>>;
+                value_or_else::result_t<Nullable>>;
+        };
+
+        template <nullable Nullable, typename Action>
+        static constexpr bool is_nothrow_applicable_on = requires {
+            requires is_applicable_on<Nullable, Action>;
+            requires is_nothrow_on_value<Nullable>;
+            requires is_nothrow_on_null<Nullable, Action>;
         };
 
         template <typename Action, nullable Nullable>
         [[nodiscard]]
         static constexpr auto on_value([[maybe_unused]] Action&& action, Nullable&& opt)
+            noexcept(is_nothrow_on_value<Nullable>)
         {
             if constexpr (is_applicable_on<Nullable, Action>)
             {
@@ -59,10 +82,11 @@ namespace gimo::detail::value_or_else
         template <typename Action, nullable Nullable>
         [[nodiscard]]
         static constexpr auto on_null(Action&& action, [[maybe_unused]] Nullable&& opt)
+            noexcept(is_nothrow_on_null<Nullable, Action>)
         {
             if constexpr (is_applicable_on<Nullable, Action>)
             {
-                return static_cast<result_t<Nullable>>(
+                return static_cast<value_or_else::result_t<Nullable>>(
                     std::invoke(std::forward<Action>(action)));
             }
             else
@@ -0,0 +1,531 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_EXT_ARENA_HPP
+#define GIMO_EXT_ARENA_HPP
+
+#pragma once
+
+#include "gimo/Config.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    template <typename T>
+    struct traits;
+
+    /**
+     * \brief Determines, whether the type can be used as arena for the `ArenaHandle`.
+     */
+    template <typename Arena>
+    concept arena = std::default_initializable<Arena>
+                 && requires(Arena& arena, void* const ptr, std::size_t const size, std::size_t const alignment) {
+                        { arena.allocate(size, alignment) } -> std::same_as<void*>;
+                        { arena.deallocate(ptr, size, alignment) } noexcept;
+                        { arena.reset() } noexcept;
+                    };
+
+    /**
+     * \brief An arena, which hands out memory by bumping a pointer through a list of chunks.
+     * \details
+     * Deallocation is a no-op; the memory is solely reclaimed by `reset` (or the destructor).
+     * The chunks are obtained from the global heap, growing geometrically.
+     * When multiple chunks are held during a `reset`, they are released and replaced by a single chunk of their combined size
+     * on the next allocation. Thus, a repeated workload settles on one chunk and stops allocating.
+     */
+    class MonotonicArena
+    {
+    public:
+        static constexpr std::size_t default_chunk_size{64u * 1024u};
+
+        MonotonicArena() = default;
+
+        [[nodiscard]]
+        explicit MonotonicArena(std::size_t const initialChunkSize) noexcept
+            : m_NextChunkSize{std::max(initialChunkSize, sizeof(Chunk))}
+        {
+        }
+
+        MonotonicArena(MonotonicArena const&) = delete;
+        MonotonicArena& operator=(MonotonicArena const&) = delete;
+        MonotonicArena(MonotonicArena&&) = delete;
+        MonotonicArena& operator=(MonotonicArena&&) = delete;
+
+        ~MonotonicArena() noexcept
+        {
+            release(m_Chunks);
+        }
+
+        [[nodiscard]]
+        void* allocate(std::size_t const size, std::size_t const alignment)
+        {
+            GIMO_ASSERT(std::has_single_bit(alignment), "Alignment must be a power of two.", alignment);
+
+            if (void* const memory = try_bump(size, alignment))
+            {
+                return memory;
+            }
+
+            grow(size + alignment);
+            void* const memory = try_bump(size, alignment);
+            GIMO_ASSERT(memory, "Fresh chunk is too small.", size, alignment);
+
+            return memory;
+        }
+
+        void deallocate(
+            [[maybe_unused]] void* const ptr,
+            [[maybe_unused]] std::size_t const size,
+            [[maybe_unused]] std::size_t const alignment) noexcept
+        {
+        }
+
+        /**
+         * \brief Reclaims all memory at once.
+         * \attention All objects, which live in this arena, must have been destroyed beforehand.
+         */
+        void reset() noexcept
+        {
+            if (m_Chunks && !m_Chunks->next)
+            {
+                m_Current = m_Chunks->data();
+            }
+            else if (m_Chunks)
+            {
+                std::size_t capacity{0u};
+                for (Chunk const* chunk = m_Chunks; chunk; chunk = chunk->next)
+                {
+                    capacity += chunk->size;
+                }
+
+                release(std::exchange(m_Chunks, nullptr));
+                m_Current = nullptr;
+                m_End = nullptr;
+                m_NextChunkSize = std::max(m_NextChunkSize, capacity);
+            }
+        }
+
+        /**
+         * \brief Returns the number of chunks, which are currently held.
+         */
+        [[nodiscard]]
+        std::size_t chunk_count() const noexcept
+        {
+            std::size_t count{0u};
+            for (Chunk const* chunk = m_Chunks; chunk; chunk = chunk->next)
+            {
+                ++count;
+            }
+
+            return count;
+        }
+
+    private:
+        struct alignas(std::max_align_t) Chunk
+        {
+            Chunk* next;
+            std::size_t size;
+
+            [[nodiscard]]
+            std::byte* data() noexcept
+            {
+                return reinterpret_cast<std::byte*>(this + 1);
+            }
+
+            [[nodiscard]]
+            std::byte* end() noexcept
+            {
+                return reinterpret_cast<std::byte*>(this) + size;
+            }
+        };
+
+        Chunk* m_Chunks{};
+        std::byte* m_Current{};
+        std::byte* m_End{};
+        std::size_t m_NextChunkSize{default_chunk_size};
+
+        [[nodiscard]]
+        void* try_bump(std::size_t const size, std::size_t const alignment) noexcept
+        {
+            auto const address = reinterpret_cast<std::uintptr_t>(m_Current);
+            auto const aligned = (address + alignment - 1u) & ~(alignment - 1u);
+            std::size_t const available = static_cast<std::size_t>(m_End - m_Current);
+            if (!m_Current || available < aligned - address + size)
+            {
+                return nullptr;
+            }
+
+            std::byte* const memory = m_Current + (aligned - address);
+            m_Current = memory + size;
+
+            return memory;
+        }
+
+        void grow(std::size_t const minSize)
+        {
+            std::size_t const size = std::max(m_NextChunkSize, sizeof(Chunk) + minSize);
+            auto* const chunk = ::new (::operator new(size)) Chunk{m_Chunks, size};
+            m_Chunks = chunk;
+            m_Current = chunk->data();
+            m_End = chunk->end();
+            m_NextChunkSize = size * 2u;
+        }
+
+        static void release(Chunk* chunk) noexcept
+        {
+            while (chunk)
+            {
+                Chunk* const next = chunk->next;
+                ::operator delete(chunk, chunk->size);
+                chunk = next;
+            }
+        }
+    };
+
+    /**
+     * \brief An arena, which recycles deallocated blocks via segregated free-lists.
+     * \details
+     * Requests are rounded up to the next power of two (at least the size of a pointer) and served from the free-list
+     * of that size-class. Fresh blocks are carved from an internal `MonotonicArena`.
+     * Requests beyond `max_block_size` are never recycled, but still reclaimed by `reset`.
+     */
+    class PoolArena
+    {
+    public:
+        static constexpr std::size_t max_block_size{4096u};
+
+        PoolArena() = default;
+
+        [[nodiscard]]
+        explicit PoolArena(std::size_t const initialChunkSize) noexcept
+            : m_Backing{initialChunkSize}
+        {
+        }
+
+        [[nodiscard]]
+        void* allocate(std::size_t const size, std::size_t const alignment)
+        {
+            std::size_t const blockSize = block_size_for(size, alignment);
+            if (max_block_size < blockSize)
+            {
+                return m_Backing.allocate(size, alignment);
+            }
+
+            FreeBlock*& head = m_FreeLists[class_index(blockSize)];
+            if (head)
+            {
+                return std::exchange(head, head->next);
+            }
+
+            return m_Backing.allocate(blockSize, blockSize);
+        }
+
+        void deallocate(void* const ptr, std::size_t const size, std::size_t const alignment) noexcept
+        {
+            std::size_t const blockSize = block_size_for(size, alignment);
+            if (blockSize <= max_block_size)
+            {
+                FreeBlock*& head = m_FreeLists[class_index(blockSize)];
+                head = ::new (ptr) FreeBlock{head};
+            }
+        }
+
+        /**
+         * \brief Reclaims all memory at once.
+         * \attention All objects, which live in this arena, must have been destroyed beforehand.
+         */
+        void reset() noexcept
+        {
+            m_FreeLists.fill(nullptr);
+            m_Backing.reset();
+        }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        static constexpr std::size_t min_block_size{sizeof(FreeBlock)};
+        static constexpr std::size_t class_count = std::countr_zero(max_block_size) - std::countr_zero(min_block_size) + 1u;
+
+        MonotonicArena m_Backing{};
+        std::array<FreeBlock*, class_count> m_FreeLists{};
+
+        [[nodiscard]]
+        static constexpr std::size_t block_size_for(std::size_t const size, std::size_t const alignment) noexcept
+        {
+            return std::bit_ceil(std::max({size, alignment, min_block_size}));
+        }
+
+        [[nodiscard]]
+        static constexpr std::size_t class_index(std::size_t const blockSize) noexcept
+        {
+            return static_cast<std::size_t>(std::countr_zero(blockSize) - std::countr_zero(min_block_size));
+        }
+    };
+
+    namespace detail::arena_scope
+    {
+        template <gimo::arena Arena>
+        inline thread_local Arena* currentArena{nullptr};
+    }
+
+    /**
+     * \brief Returns the arena, which is exclusively owned by the calling thread.
+     */
+    template <arena Arena>
+    [[nodiscard]]
+    Arena& thread_arena() noexcept(std::is_nothrow_default_constructible_v<Arena>)
+    {
+        thread_local Arena arena{};
+
+        return arena;
+    }
+
+    /**
+     * \brief Returns the arena, which is currently installed on the calling thread.
+     * \details
+     * Defaults to `thread_arena<Arena>()`, if no `ArenaScope` is active.
+     */
+    template <arena Arena>
+    [[nodiscard]]
+    Arena& current_arena()
+    {
+        if (Arena* const arena = detail::arena_scope::currentArena<Arena>)
+        {
+            return *arena;
+        }
+
+        return thread_arena<Arena>();
+    }
+
+    /**
+     * \brief Installs the arena as the current one of the calling thread, until the scope is left.
+     */
+    template <arena Arena>
+    class ArenaScope
+    {
+    public:
+        [[nodiscard]]
+        explicit ArenaScope(Arena& arena) noexcept
+            : m_Previous{std::exchange(detail::arena_scope::currentArena<Arena>, &arena)}
+        {
+        }
+
+        ArenaScope(ArenaScope const&) = delete;
+        ArenaScope& operator=(ArenaScope const&) = delete;
+        ArenaScope(ArenaScope&&) = delete;
+        ArenaScope& operator=(ArenaScope&&) = delete;
+
+        ~ArenaScope() noexcept
+        {
+            detail::arena_scope::currentArena<Arena> = m_Previous;
+        }
+
+    private:
+        Arena* m_Previous;
+    };
+
+    /**
+     * \brief An owning handle to an object, which lives inside an arena.
+     * \tparam T The object-type.
+     * \tparam Arena The arena-type.
+     * \details
+     * The handle behaves like a `std::unique_ptr`, but obtains its memory from an arena instead of the global heap.
+     * When used with the monadic algorithms, rebound handles are allocated from the same arena as their source;
+     * newly created ones (e.g. via `or_else`) are allocated from the `current_arena`.
+     */
+    template <typename T, arena Arena = MonotonicArena>
+        requires std::is_object_v<T> && (!std::is_array_v<T>)
+    class ArenaHandle
+    {
+    public:
+        using element_type = T;
+        using arena_type = Arena;
+
+        ArenaHandle() = default;
+
+        [[nodiscard]]
+        explicit(false) constexpr ArenaHandle([[maybe_unused]] std::nullptr_t const null) noexcept
+        {
+        }
+
+        /**
+         * \brief Creates the object inside the given arena.
+         */
+        template <typename... Args>
+            requires std::constructible_from<T, Args&&...>
+        [[nodiscard]]
+        explicit ArenaHandle([[maybe_unused]] std::in_place_t const tag, Arena& arena, Args&&... args)
+            : m_Arena{&arena}
+        {
+            void* const memory = arena.allocate(sizeof(T), alignof(T));
+            try
+            {
+                m_Value = ::new (memory) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                arena.deallocate(memory, sizeof(T), alignof(T));
+                throw;
+            }
+        }
+
+        ArenaHandle(ArenaHandle const&) = delete;
+        ArenaHandle& operator=(ArenaHandle const&) = delete;
+
+        [[nodiscard]]
+        constexpr ArenaHandle(ArenaHandle&& other) noexcept
+            : m_Value{std::exchange(other.m_Value, nullptr)},
+              m_Arena{other.m_Arena}
+        {
+        }
+
+        constexpr ArenaHandle& operator=(ArenaHandle&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                m_Value = std::exchange(other.m_Value, nullptr);
+                m_Arena = other.m_Arena;
+            }
+
+            return *this;
+        }
+
+        constexpr ~ArenaHandle() noexcept
+        {
+            reset();
+        }
+
+        /**
+         * \brief Destroys the object and returns its memory to the arena.
+         */
+        constexpr void reset() noexcept
+        {
+            if (T* const value = std::exchange(m_Value, nullptr))
+            {
+                value->~T();
+                m_Arena->deallocate(const_cast<std::remove_cv_t<T>*>(value), sizeof(T), alignof(T));
+            }
+        }
+
+        [[nodiscard]]
+        constexpr T* get() const noexcept
+        {
+            return m_Value;
+        }
+
+        /**
+         * \brief Returns the arena, which the object lives in.
+         */
+        [[nodiscard]]
+        constexpr Arena* arena() const noexcept
+        {
+            return m_Arena;
+        }
+
+        [[nodiscard]]
+        constexpr T& operator*() const noexcept
+        {
+            GIMO_ASSERT(m_Value, "Handle must not be null.");
+
+            return *m_Value;
+        }
+
+        [[nodiscard]]
+        constexpr T* operator->() const noexcept
+        {
+            GIMO_ASSERT(m_Value, "Handle must not be null.");
+
+            return m_Value;
+        }
+
+        [[nodiscard]]
+        explicit constexpr operator bool() const noexcept
+        {
+            return nullptr != m_Value;
+        }
+
+        [[nodiscard]]
+        constexpr bool operator==([[maybe_unused]] std::nullptr_t const null) const noexcept
+        {
+            return !m_Value;
+        }
+
+    private:
+        T* m_Value{};
+        Arena* m_Arena{};
+    };
+
+    /**
+     * \brief Creates an `ArenaHandle` inside the given arena.
+     */
+    template <typename T, arena Arena, typename... Args>
+        requires std::constructible_from<T, Args&&...>
+    [[nodiscard]]
+    ArenaHandle<T, Arena> make_arena_handle(Arena& arena, Args&&... args)
+    {
+        return ArenaHandle<T, Arena>{std::in_place, arena, std::forward<Args>(args)...};
+    }
+}
+
+template <typename T, typename Arena>
+struct gimo::traits<gimo::ArenaHandle<T, Arena>>
+{
+    using Handle = ArenaHandle<T, Arena>;
+
+    static constexpr std::nullptr_t null{};
+
+    [[nodiscard]]
+    static constexpr T& value(Handle const& handle) noexcept
+    {
+        return *handle;
+    }
+
+    [[nodiscard]]
+    static constexpr T&& value(Handle&& handle) noexcept
+    {
+        return std::move(*handle);
+    }
+
+    template <typename V>
+    using rebind_value = ArenaHandle<V, Arena>;
+
+    [[nodiscard]]
+    static constexpr bool owns_value([[maybe_unused]] Handle const& handle) noexcept
+    {
+        return true;
+    }
+
+    template <typename Arg>
+        requires std::constructible_from<T, Arg&&>
+    [[nodiscard]]
+    static Handle from_value(Arg&& arg)
+    {
+        return Handle{std::in_place, current_arena<Arena>(), std::forward<Arg>(arg)};
+    }
+
+    template <typename V, typename Arg>
+        requires std::constructible_from<V, Arg&&>
+    [[nodiscard]]
+    static rebind_value<V> from_value_like(Handle const& source, Arg&& arg)
+    {
+        return rebind_value<V>{std::in_place, *source.arena(), std::forward<Arg>(arg)};
+    }
+};
+
+#endif
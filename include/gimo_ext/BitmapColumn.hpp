@@ -0,0 +1,426 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_EXT_BITMAP_COLUMN_HPP
+#define GIMO_EXT_BITMAP_COLUMN_HPP
+
+#pragma once
+
+#include "gimo/Batch.hpp"
+#include "gimo/Common.hpp"
+#include "gimo/Config.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gimo
+{
+    /**
+     * \brief A non-owning view of a column, which stores its values and their validity separately.
+     * \tparam T The value-type.
+     * \details
+     * The `i`-th value is valid, if the `i % 64`-th bit of the `i / 64`-th validity-word is set.
+     * The content of invalid value-slots is unspecified.
+     */
+    template <typename T>
+    class BitmapColumnView
+    {
+    public:
+        static constexpr std::size_t word_bits{64u};
+
+        [[nodiscard]]
+        static constexpr std::size_t word_count(std::size_t const size) noexcept
+        {
+            return (size + word_bits - 1u) / word_bits;
+        }
+
+        BitmapColumnView() = default;
+
+        /**
+         * \brief Creates a view of the given values and validity-bitmap.
+         * \param values The values.
+         * \param validity The validity-bitmap. Must contain at least one bit per value.
+         */
+        [[nodiscard]]
+        constexpr BitmapColumnView(std::span<T const> const values, std::span<std::uint64_t const> const validity) noexcept
+            : m_Values{values},
+              m_Validity{validity}
+        {
+            GIMO_ASSERT(word_count(values.size()) <= validity.size(), "Validity-bitmap is too small.", values, validity);
+        }
+
+        [[nodiscard]]
+        constexpr std::size_t size() const noexcept
+        {
+            return m_Values.size();
+        }
+
+        [[nodiscard]]
+        constexpr std::span<T const> values() const noexcept
+        {
+            return m_Values;
+        }
+
+        [[nodiscard]]
+        constexpr std::span<std::uint64_t const> validity() const noexcept
+        {
+            return m_Validity;
+        }
+
+        [[nodiscard]]
+        constexpr bool is_valid(std::size_t const index) const noexcept
+        {
+            GIMO_ASSERT(index < size(), "Index out of bounds.", index);
+
+            return 0u != (m_Validity[index / word_bits] & (std::uint64_t{1u} << (index % word_bits)));
+        }
+
+        /**
+         * \brief Returns a copy of the `index`-th element.
+         */
+        [[nodiscard]]
+        constexpr std::optional<T> operator[](std::size_t const index) const
+        {
+            if (is_valid(index))
+            {
+                return m_Values[index];
+            }
+
+            return std::nullopt;
+        }
+
+    private:
+        std::span<T const> m_Values{};
+        std::span<std::uint64_t const> m_Validity{};
+    };
+
+    /**
+     * \brief An owning column, which stores its values and their validity separately.
+     * \tparam T The value-type.
+     * \details
+     * Compared to `std::vector<std::optional<T>>` this avoids the padding of each element,
+     * as the validity of 64 elements is packed into a single word.
+     */
+    template <std::default_initializable T>
+    class BitmapColumn
+    {
+    public:
+        using View = BitmapColumnView<T>;
+
+        BitmapColumn() = default;
+
+        /**
+         * \brief Creates a column with `size` invalid elements.
+         */
+        [[nodiscard]]
+        explicit constexpr BitmapColumn(std::size_t const size)
+            : m_Values(size),
+              m_Validity(View::word_count(size), 0u)
+        {
+        }
+
+        [[nodiscard]]
+        constexpr std::size_t size() const noexcept
+        {
+            return m_Values.size();
+        }
+
+        [[nodiscard]]
+        constexpr std::span<T> values() noexcept
+        {
+            return m_Values;
+        }
+
+        [[nodiscard]]
+        constexpr std::span<T const> values() const noexcept
+        {
+            return m_Values;
+        }
+
+        [[nodiscard]]
+        constexpr std::span<std::uint64_t> validity() noexcept
+        {
+            return m_Validity;
+        }
+
+        [[nodiscard]]
+        constexpr std::span<std::uint64_t const> validity() const noexcept
+        {
+            return m_Validity;
+        }
+
+        [[nodiscard]]
+        constexpr View view() const noexcept
+        {
+            return View{m_Values, m_Validity};
+        }
+
+        [[nodiscard]]
+        explicit(false) constexpr operator View() const noexcept
+        {
+            return view();
+        }
+
+        [[nodiscard]]
+        constexpr bool is_valid(std::size_t const index) const noexcept
+        {
+            return view().is_valid(index);
+        }
+
+        /**
+         * \copydoc BitmapColumnView::operator[]
+         */
+        [[nodiscard]]
+        constexpr std::optional<T> operator[](std::size_t const index) const
+        {
+            return view()[index];
+        }
+
+        /**
+         * \brief Assigns the value to the `index`-th element and marks it as valid.
+         */
+        template <typename Value>
+            requires std::assignable_from<T&, Value&&>
+        constexpr void set(std::size_t const index, Value&& value)
+        {
+            GIMO_ASSERT(index < size(), "Index out of bounds.", index);
+
+            m_Values[index] = std::forward<Value>(value);
+            m_Validity[index / View::word_bits] |= std::uint64_t{1u} << (index % View::word_bits);
+        }
+
+        /**
+         * \brief Marks the `index`-th element as invalid.
+         */
+        constexpr void reset(std::size_t const index) noexcept
+        {
+            GIMO_ASSERT(index < size(), "Index out of bounds.", index);
+
+            m_Validity[index / View::word_bits] &= ~(std::uint64_t{1u} << (index % View::word_bits));
+        }
+
+    private:
+        std::vector<T> m_Values{};
+        std::vector<std::uint64_t> m_Validity{};
+    };
+
+    // Lives in its own namespace, so that ADL doesn't consider the `gimo::detail::value` function.
+    namespace detail::bitmap_column
+    {
+        /**
+         * \brief The nullable, which is provided to the pipeline for each valid element of a column.
+         * \details
+         * As it's only ever created for valid elements, the pipeline can omit the emptiness-check of the first step.
+         */
+        template <typename T>
+        class ValidCell
+        {
+        public:
+            [[nodiscard]]
+            explicit constexpr ValidCell(T const& value) noexcept
+                : m_Value{&value}
+            {
+            }
+
+            [[nodiscard]]
+            explicit(false) constexpr ValidCell([[maybe_unused]] std::nullptr_t const null) noexcept
+            {
+            }
+
+            [[nodiscard]]
+            constexpr T const& operator*() const noexcept
+            {
+                return *m_Value;
+            }
+
+            [[nodiscard]]
+            constexpr bool operator==(std::nullptr_t const null) const noexcept
+            {
+                return m_Value == null;
+            }
+
+        private:
+            T const* m_Value{};
+        };
+    }
+
+    template <typename T>
+    struct traits<detail::bitmap_column::ValidCell<T>>
+    {
+        static constexpr std::nullptr_t null{};
+        static constexpr bool always_engaged{true};
+
+        template <typename V>
+        using rebind_value = std::optional<V>;
+    };
+
+    namespace detail
+    {
+        template <typename Pipeline, typename Nullable>
+        struct is_null_propagating_pipeline;
+
+        template <typename... Steps, typename Nullable>
+        struct is_null_propagating_pipeline<Pipeline<Steps...>, Nullable>
+            : public std::bool_constant<sizeof...(Steps) == null_propagation<Nullable, Nullable, Steps const&...>::skipped>
+        {
+        };
+
+        template <typename Result>
+        struct column_value
+        {
+            using type = std::remove_cvref_t<Result>;
+        };
+
+        template <nullable Result>
+        struct column_value<Result>
+        {
+            using type = std::remove_cvref_t<value_result_t<Result>>;
+        };
+
+        template <typename T, typename Pipeline>
+        using column_value_t = typename column_value<apply_result_t<std::optional<T>, Pipeline>>::type;
+
+        /**
+         * \brief Stores the content of the pipeline result into the value-slot.
+         * \return Whether the result contains a value.
+         */
+        template <typename Value, typename Result>
+        [[nodiscard]]
+        constexpr bool store_result(Value& slot, Result&& result)
+        {
+            if constexpr (nullable<Result>)
+            {
+                if (!detail::has_value(result))
+                {
+                    return false;
+                }
+
+                slot = detail::forward_value<Result>(result);
+            }
+            else
+            {
+                slot = std::forward<Result>(result);
+            }
+
+            return true;
+        }
+    }
+
+    /**
+     * \brief Applies each element of the column on the pipeline and collects the results in a new column.
+     * \tparam T The value-type of the source column.
+     * \tparam Pipeline The pipeline type.
+     * \param column The source column.
+     * \param pipeline The pipeline to execute for each element.
+     * \return A new column, whose validity reflects the null-state of the results.
+     * \details
+     * Valid elements are provided as always engaged nullables, while invalid ones are provided as `std::optional<T>`.
+     *
+     * When each step of the pipeline merely propagates the null-state, invalid elements are never applied at all.
+     * In that case, the validity-bitmap is processed word-wise, so that:
+     * - words without any valid element are skipped entirely,
+     * - words with only valid elements are processed without any test,
+     * - and in all other words only the valid elements are visited.
+     */
+    template <typename T, pipeline Pipeline>
+        requires processable_by<detail::bitmap_column::ValidCell<T>, Pipeline const&>
+              && processable_by<std::optional<T>, Pipeline const&>
+              && std::default_initializable<detail::column_value_t<T, Pipeline>>
+    [[nodiscard]]
+    constexpr BitmapColumn<detail::column_value_t<T, Pipeline>> apply_each(BitmapColumnView<T> const column, Pipeline const& pipeline)
+    {
+        using View = BitmapColumnView<T>;
+        constexpr bool propagatesNull = detail::is_null_propagating_pipeline<Pipeline, std::optional<T>>::value;
+
+        // Bound as const, so that the `const&` overload of `apply` is used, which the constraints check for.
+        auto const& steps = detail::hoist_pipeline(pipeline);
+        std::size_t const size = column.size();
+        BitmapColumn<detail::column_value_t<T, Pipeline>> result(size);
+
+        std::span const input = column.values();
+        std::span const output = result.values();
+        for (std::size_t word{0u}; word < View::word_count(size); ++word)
+        {
+            std::size_t const offset = word * View::word_bits;
+            std::size_t const count = std::min(View::word_bits, size - offset);
+            std::uint64_t const mask = count == View::word_bits
+                                         ? ~std::uint64_t{0u}
+                                         : (std::uint64_t{1u} << count) - 1u;
+            std::uint64_t const validity = column.validity()[word] & mask;
+
+            auto const process = [&](std::size_t const index) -> std::uint64_t {
+                bool const isValid = detail::store_result(
+                    output[index],
+                    steps.apply(detail::bitmap_column::ValidCell<T>{input[index]}));
+                return std::uint64_t{isValid} << (index - offset);
+            };
+
+            std::uint64_t resultValidity{0u};
+            if constexpr (propagatesNull)
+            {
+                if (validity == mask)
+                {
+                    for (std::size_t i{offset}; i < offset + count; ++i)
+                    {
+                        resultValidity |= process(i);
+                    }
+                }
+                else
+                {
+                    for (std::uint64_t pending = validity; 0u != pending; pending &= pending - 1u)
+                    {
+                        resultValidity |= process(offset + static_cast<std::size_t>(std::countr_zero(pending)));
+                    }
+                }
+            }
+            else
+            {
+                for (std::size_t i{offset}; i < offset + count; ++i)
+                {
+                    if (0u != (validity & (std::uint64_t{1u} << (i - offset))))
+                    {
+                        resultValidity |= process(i);
+                    }
+                    else
+                    {
+                        bool const isValid = detail::store_result(
+                            output[i],
+                            steps.apply(std::optional<T>{}));
+                        resultValidity |= std::uint64_t{isValid} << (i - offset);
+                    }
+                }
+            }
+
+            result.validity()[word] = resultValidity;
+        }
+
+        return result;
+    }
+
+    /**
+     * \copydoc apply_each(BitmapColumnView<T>, Pipeline const&)
+     */
+    template <typename T, pipeline Pipeline>
+        requires requires(BitmapColumnView<T> const column, Pipeline const& pipeline) {
+            gimo::apply_each(column, pipeline);
+        }
+    [[nodiscard]]
+    constexpr auto apply_each(BitmapColumn<T> const& column, Pipeline const& pipeline)
+    {
+        return gimo::apply_each(column.view(), pipeline);
+    }
+}
+
+#endif
@@ -0,0 +1,199 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_EXT_COMPACT_EXPECTED_HPP
+#define GIMO_EXT_COMPACT_EXPECTED_HPP
+
+#pragma once
+
+#include "gimo/Config.hpp"
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    template <typename T>
+    struct traits;
+
+    /**
+     * \brief Determines, whether the type can be stored as value or error of a `CompactExpected`.
+     * \details Such types must be trivially copyable, trivially default constructible and at most as large as a pointer.
+     */
+    template <typename T>
+    concept compactly_storable = std::is_object_v<T>
+                              && !std::is_const_v<T>
+                              && std::is_trivially_copyable_v<T>
+                              && std::is_trivially_default_constructible_v<T>
+                              && sizeof(T) <= sizeof(void*);
+
+    /**
+     * \brief An expected, which is trivially copyable and at most twice as large as a pointer.
+     * \tparam T The value-type.
+     * \tparam E The error-type.
+     * \details
+     * Value and error share their storage, which is followed by the engagement flag.
+     * As the type doesn't exceed two machine-words and is trivially copyable, common ABIs (e.g. SysV x86-64)
+     * return it via registers; unlike `std::expected<int, std::error_code>`, which is returned via memory.
+     */
+    template <compactly_storable T, compactly_storable E>
+    class CompactExpected
+    {
+    public:
+        using value_type = T;
+        using error_type = E;
+
+        struct null_t
+        {
+            [[nodiscard]]
+            friend constexpr bool operator==(CompactExpected const& exp, [[maybe_unused]] null_t const tag) noexcept
+            {
+                return !exp.has_value();
+            }
+
+            [[nodiscard]]
+            explicit(false) constexpr operator CompactExpected() const noexcept
+            {
+                return CompactExpected::from_error(E{});
+            }
+        };
+
+        /**
+         * \brief Creates an expected with a value-initialized value.
+         */
+        [[nodiscard]]
+        constexpr CompactExpected() noexcept
+            : CompactExpected{T{}}
+        {
+        }
+
+        [[nodiscard]]
+        explicit(false) constexpr CompactExpected(T const value) noexcept
+            : m_Storage{.value = value},
+              m_HasValue{true}
+        {
+        }
+
+        [[nodiscard]]
+        static constexpr CompactExpected from_error(E const error) noexcept
+        {
+            return CompactExpected{error, 0};
+        }
+
+        [[nodiscard]]
+        constexpr bool has_value() const noexcept
+        {
+            return m_HasValue;
+        }
+
+        [[nodiscard]]
+        explicit constexpr operator bool() const noexcept
+        {
+            return m_HasValue;
+        }
+
+        [[nodiscard]]
+        constexpr T const& operator*() const noexcept
+        {
+            GIMO_ASSERT(m_HasValue, "Expected must contain a value.");
+
+            return m_Storage.value;
+        }
+
+        [[nodiscard]]
+        constexpr T& operator*() noexcept
+        {
+            GIMO_ASSERT(m_HasValue, "Expected must contain a value.");
+
+            return m_Storage.value;
+        }
+
+        [[nodiscard]]
+        constexpr E const& error() const noexcept
+        {
+            GIMO_ASSERT(!m_HasValue, "Expected must contain an error.");
+
+            return m_Storage.error;
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(CompactExpected const& lhs, CompactExpected const& rhs) noexcept
+            requires std::equality_comparable<T>
+                  && std::equality_comparable<E>
+        {
+            if (lhs.m_HasValue != rhs.m_HasValue)
+            {
+                return false;
+            }
+
+            return lhs.m_HasValue
+                     ? lhs.m_Storage.value == rhs.m_Storage.value
+                     : lhs.m_Storage.error == rhs.m_Storage.error;
+        }
+
+    private:
+        union Storage
+        {
+            T value;
+            E error;
+        };
+
+        Storage m_Storage;
+        bool m_HasValue;
+
+        [[nodiscard]]
+        constexpr CompactExpected(E const error, [[maybe_unused]] int const tag) noexcept
+            : m_Storage{.error = error},
+              m_HasValue{false}
+        {
+        }
+    };
+
+    namespace detail::compact_expected
+    {
+        struct Probe
+        {
+            int value;
+        };
+
+        static_assert(sizeof(CompactExpected<Probe, short>) <= 2u * sizeof(void*));
+        static_assert(sizeof(CompactExpected<void*, void*>) <= 2u * sizeof(void*));
+        static_assert(std::is_trivially_copyable_v<CompactExpected<Probe, short>>);
+        static_assert(std::is_trivially_destructible_v<CompactExpected<Probe, short>>);
+    }
+}
+
+/**
+ * \details
+ * Value- and error-type can only be rebound to compactly storable types.
+ */
+template <typename T, typename E>
+struct gimo::traits<gimo::CompactExpected<T, E>>
+{
+    using expected = CompactExpected<T, E>;
+
+    static constexpr typename expected::null_t null{};
+
+    template <compactly_storable V>
+    using rebind_value = CompactExpected<V, E>;
+
+    template <compactly_storable Error>
+    using rebind_error = CompactExpected<T, Error>;
+
+    [[nodiscard]]
+    static constexpr bool owns_value([[maybe_unused]] expected const& exp) noexcept
+    {
+        return true;
+    }
+
+    [[nodiscard]]
+    static constexpr expected from_error(E const error) noexcept
+    {
+        return expected::from_error(error);
+    }
+};
+
+#endif
@@ -0,0 +1,287 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_EXT_COMPACT_OPTIONAL_HPP
+#define GIMO_EXT_COMPACT_OPTIONAL_HPP
+
+#pragma once
+
+#include "gimo/Config.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include <concepts>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    template <typename T>
+    struct traits;
+
+    /**
+     * \brief Customization point, which defines the sentinel representing the null-state of a `CompactOptional<T>`.
+     * \tparam T The value-type.
+     * \details
+     * Specializations must provide `static constexpr T null_value()` and `static constexpr bool is_null(T const&)`.
+     * The library provides specializations for:
+     * - signed integrals (`std::numeric_limits<T>::min()`),
+     * - unsigned integrals (`std::numeric_limits<T>::max()`),
+     * - floating-points (quiet NaN; any NaN is treated as null),
+     * - and pointers (`nullptr`).
+     */
+    template <typename T>
+    struct sentinel_policy;
+
+    template <std::signed_integral T>
+    struct sentinel_policy<T>
+    {
+        [[nodiscard]]
+        static constexpr T null_value() noexcept
+        {
+            return std::numeric_limits<T>::min();
+        }
+
+        [[nodiscard]]
+        static constexpr bool is_null(T const value) noexcept
+        {
+            return value == null_value();
+        }
+    };
+
+    template <std::unsigned_integral T>
+        requires(!std::same_as<bool, T>)
+    struct sentinel_policy<T>
+    {
+        [[nodiscard]]
+        static constexpr T null_value() noexcept
+        {
+            return std::numeric_limits<T>::max();
+        }
+
+        [[nodiscard]]
+        static constexpr bool is_null(T const value) noexcept
+        {
+            return value == null_value();
+        }
+    };
+
+    template <std::floating_point T>
+    struct sentinel_policy<T>
+    {
+        [[nodiscard]]
+        static constexpr T null_value() noexcept
+        {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+
+        [[nodiscard]]
+        static constexpr bool is_null(T const value) noexcept
+        {
+            // A constexpr-friendly `std::isnan`.
+            return value != value;
+        }
+    };
+
+    template <typename T>
+    struct sentinel_policy<T*>
+    {
+        [[nodiscard]]
+        static constexpr T* null_value() noexcept
+        {
+            return nullptr;
+        }
+
+        [[nodiscard]]
+        static constexpr bool is_null(T const* const value) noexcept
+        {
+            return value == nullptr;
+        }
+    };
+
+    /**
+     * \brief A sentinel-policy, which uses the given constant as sentinel.
+     * \tparam Sentinel The sentinel value.
+     */
+    template <auto Sentinel>
+    struct value_sentinel
+    {
+        [[nodiscard]]
+        static constexpr decltype(Sentinel) null_value() noexcept
+        {
+            return Sentinel;
+        }
+
+        [[nodiscard]]
+        static constexpr bool is_null(decltype(Sentinel) const& value) noexcept
+        {
+            return value == Sentinel;
+        }
+    };
+
+    /**
+     * \brief Determines, whether the policy provides a sentinel for the value-type.
+     */
+    template <typename Policy, typename T>
+    concept sentinel_policy_for = std::copyable<T>
+                               && requires(T const& value) {
+                                      { Policy::null_value() } -> std::convertible_to<T>;
+                                      { Policy::is_null(value) } -> std::convertible_to<bool>;
+                                  };
+
+    /**
+     * \brief An optional, which encodes its null-state as a sentinel value and is thus as large as its value-type.
+     * \tparam T The value-type.
+     * \tparam Policy The sentinel-policy.
+     * \attention Storing the sentinel value as a value is not possible; it's indistinguishable from the null-state.
+     */
+    template <typename T, sentinel_policy_for<T> Policy = sentinel_policy<T>>
+    class CompactOptional
+    {
+    public:
+        using value_type = T;
+        using policy_type = Policy;
+
+        [[nodiscard]]
+        constexpr CompactOptional() noexcept(std::is_nothrow_copy_constructible_v<T>)
+            : m_Value(Policy::null_value())
+        {
+        }
+
+        [[nodiscard]]
+        explicit(false) constexpr CompactOptional([[maybe_unused]] std::nullopt_t const null) noexcept(std::is_nothrow_copy_constructible_v<T>)
+            : CompactOptional{}
+        {
+        }
+
+        template <typename U = T>
+            requires std::constructible_from<T, U&&>
+                  && (!std::same_as<CompactOptional, std::remove_cvref_t<U>>)
+                  && (!std::same_as<std::nullopt_t, std::remove_cvref_t<U>>)
+        [[nodiscard]]
+        explicit(!std::convertible_to<U&&, T>) constexpr CompactOptional(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>)
+            : m_Value(std::forward<U>(value))
+        {
+            GIMO_ASSERT(!Policy::is_null(m_Value), "The value must not be the sentinel.");
+        }
+
+        [[nodiscard]]
+        constexpr bool has_value() const noexcept
+        {
+            return !Policy::is_null(m_Value);
+        }
+
+        [[nodiscard]]
+        explicit constexpr operator bool() const noexcept
+        {
+            return has_value();
+        }
+
+        [[nodiscard]]
+        constexpr T const& operator*() const& noexcept
+        {
+            GIMO_ASSERT(has_value(), "Optional must not be null.");
+
+            return m_Value;
+        }
+
+        [[nodiscard]]
+        constexpr T& operator*() & noexcept
+        {
+            GIMO_ASSERT(has_value(), "Optional must not be null.");
+
+            return m_Value;
+        }
+
+        [[nodiscard]]
+        constexpr T&& operator*() && noexcept
+        {
+            GIMO_ASSERT(has_value(), "Optional must not be null.");
+
+            return std::move(m_Value);
+        }
+
+        constexpr void reset() noexcept(std::is_nothrow_copy_assignable_v<T>)
+        {
+            m_Value = Policy::null_value();
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(CompactOptional const& opt, [[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+            return !opt.has_value();
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(CompactOptional const& lhs, CompactOptional const& rhs)
+            requires std::equality_comparable<T>
+        {
+            if (!lhs.has_value() || !rhs.has_value())
+            {
+                return lhs.has_value() == rhs.has_value();
+            }
+
+            return lhs.m_Value == rhs.m_Value;
+        }
+
+    private:
+        T m_Value;
+    };
+
+    namespace detail::compact_optional
+    {
+        template <typename Policy, typename V>
+        concept rebindable_policy = sentinel_policy_for<typename Policy::template rebind<V>, V>;
+
+        template <typename Policy, typename T, typename V>
+        struct rebinder
+        {
+            using type = std::optional<V>;
+        };
+
+        template <typename Policy, typename T, typename V>
+            requires sentinel_policy_for<sentinel_policy<V>, V>
+                  && (!rebindable_policy<Policy, V>)
+        struct rebinder<Policy, T, V>
+        {
+            using type = CompactOptional<V>;
+        };
+
+        template <typename Policy, typename T, typename V>
+            requires rebindable_policy<Policy, V>
+        struct rebinder<Policy, T, V>
+        {
+            using type = CompactOptional<V, typename Policy::template rebind<V>>;
+        };
+
+        template <typename Policy, typename T>
+        struct rebinder<Policy, T, T>
+        {
+            using type = CompactOptional<T, Policy>;
+        };
+    }
+}
+
+/**
+ * \details
+ * The value-type is rebound by the following precedence:
+ * 1. When it's unchanged, the policy is kept.
+ * 2. When the policy declares a `rebind<V>` alias, the rebound policy is used.
+ * 3. When `gimo::sentinel_policy<V>` is available, it's used.
+ * 4. Otherwise, `std::optional<V>` is used.
+ */
+template <typename T, typename Policy>
+struct gimo::traits<gimo::CompactOptional<T, Policy>>
+{
+    static constexpr auto null{std::nullopt};
+
+    template <typename V>
+    using rebind_value = typename detail::compact_optional::rebinder<Policy, T, V>::type;
+
+    // Intentionally no `owns_value`, as in-place assignments would bypass the sentinel check of the constructor.
+};
+
+#endif
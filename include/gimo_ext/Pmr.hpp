@@ -0,0 +1,249 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_EXT_PMR_HPP
+#define GIMO_EXT_PMR_HPP
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace gimo
+{
+    template <typename T>
+    struct traits;
+}
+
+namespace gimo::pmr
+{
+    /**
+     * \brief Deleter, which releases objects to the `std::pmr::memory_resource` they were allocated from.
+     * \tparam T The object-type.
+     * \details
+     * As it exposes its allocator, the `std::unique_ptr` adapter allocates the results of
+     * rebinding operations (e.g. `transform`) from the same memory-resource.
+     */
+    template <typename T>
+    class Deleter
+    {
+    public:
+        using allocator_type = std::pmr::polymorphic_allocator<std::remove_cv_t<T>>;
+
+        template <typename U>
+        using rebind = Deleter<U>;
+
+        /**
+         * \brief Creates a deleter for the current default memory-resource.
+         */
+        [[nodiscard]]
+        Deleter() noexcept
+            : Deleter{std::pmr::get_default_resource()}
+        {
+        }
+
+        [[nodiscard]]
+        explicit Deleter(std::pmr::memory_resource* const resource) noexcept
+            : m_Resource{resource}
+        {
+        }
+
+        [[nodiscard]]
+        explicit Deleter(allocator_type const& allocator) noexcept
+            : m_Resource{allocator.resource()}
+        {
+        }
+
+        /**
+         * \brief Converts the deleter of a differently cv-qualified object-type.
+         * \details
+         * Conversions from derived object-types are intentionally unsupported, as the deleter releases
+         * `sizeof(T)` bytes, which would not match the actual allocation.
+         */
+        template <typename U>
+            requires std::same_as<std::remove_cv_t<U>, std::remove_cv_t<T>>
+        [[nodiscard]]
+        explicit(false) Deleter(Deleter<U> const& other) noexcept
+            : m_Resource{other.resource()}
+        {
+        }
+
+        [[nodiscard]]
+        std::pmr::memory_resource* resource() const noexcept
+        {
+            return m_Resource;
+        }
+
+        [[nodiscard]]
+        allocator_type get_allocator() const noexcept
+        {
+            return allocator_type{m_Resource};
+        }
+
+        void operator()(T* const ptr) const
+        {
+            get_allocator().delete_object(const_cast<std::remove_cv_t<T>*>(ptr));
+        }
+
+    private:
+        std::pmr::memory_resource* m_Resource;
+    };
+
+    template <typename T>
+    using unique_ptr = std::unique_ptr<T, Deleter<T>>;
+
+    /**
+     * \brief Creates a `gimo::pmr::unique_ptr`, whose object is allocated from the given memory-resource.
+     */
+    template <typename T, typename... Args>
+        requires std::constructible_from<T, Args&&...>
+    [[nodiscard]]
+    unique_ptr<T> make_unique(std::pmr::memory_resource* const resource, Args&&... args)
+    {
+        Deleter<T> deleter{resource};
+        T* const ptr = deleter.get_allocator().template new_object<std::remove_cv_t<T>>(std::forward<Args>(args)...);
+
+        return unique_ptr<T>{ptr, deleter};
+    }
+
+    /**
+     * \brief Shared pointer, which remembers the `std::pmr::memory_resource` its object has been allocated from.
+     * \tparam T The object-type.
+     * \details
+     * The allocator of a `std::shared_ptr` can not be retrieved after its construction.
+     * Thus, this type carries the memory-resource alongside the pointer, so that the results of
+     * rebinding operations (e.g. `transform`) are allocated from the same memory-resource.
+     */
+    template <typename T>
+    class shared_ptr
+    {
+    public:
+        using element_type = T;
+        using allocator_type = std::pmr::polymorphic_allocator<std::remove_cv_t<T>>;
+
+        [[nodiscard]]
+        shared_ptr() = default;
+
+        [[nodiscard]]
+        explicit(false) shared_ptr([[maybe_unused]] std::nullptr_t const null) noexcept
+        {
+        }
+
+        /**
+         * \brief Adopts a pointer, whose object has been allocated from the given memory-resource.
+         */
+        [[nodiscard]]
+        explicit shared_ptr(std::shared_ptr<T> ptr, std::pmr::memory_resource* const resource) noexcept
+            : m_Ptr{std::move(ptr)},
+              m_Resource{resource}
+        {
+        }
+
+        [[nodiscard]]
+        std::pmr::memory_resource* resource() const noexcept
+        {
+            return m_Resource;
+        }
+
+        [[nodiscard]]
+        allocator_type get_allocator() const noexcept
+        {
+            return allocator_type{m_Resource};
+        }
+
+        [[nodiscard]]
+        T* get() const noexcept
+        {
+            return m_Ptr.get();
+        }
+
+        [[nodiscard]]
+        T& operator*() const noexcept
+        {
+            return *m_Ptr;
+        }
+
+        [[nodiscard]]
+        T* operator->() const noexcept
+        {
+            return m_Ptr.get();
+        }
+
+        [[nodiscard]]
+        explicit operator bool() const noexcept
+        {
+            return static_cast<bool>(m_Ptr);
+        }
+
+        /**
+         * \brief Shares the ownership with a plain `std::shared_ptr`, which no longer exposes the memory-resource.
+         */
+        [[nodiscard]]
+        explicit(false) operator std::shared_ptr<T>() const noexcept
+        {
+            return m_Ptr;
+        }
+
+        [[nodiscard]]
+        friend bool operator==(shared_ptr const& ptr, [[maybe_unused]] std::nullptr_t const null) noexcept
+        {
+            return !ptr.m_Ptr;
+        }
+
+    private:
+        std::shared_ptr<T> m_Ptr{};
+        std::pmr::memory_resource* m_Resource{std::pmr::get_default_resource()};
+    };
+
+    /**
+     * \brief Creates a `gimo::pmr::shared_ptr`, whose object and control-block are allocated from the given memory-resource.
+     */
+    template <typename T, typename... Args>
+        requires std::constructible_from<T, Args&&...>
+    [[nodiscard]]
+    shared_ptr<T> make_shared(std::pmr::memory_resource* const resource, Args&&... args)
+    {
+        typename shared_ptr<T>::allocator_type const allocator{resource};
+
+        return shared_ptr<T>{
+            std::allocate_shared<T>(allocator, std::forward<Args>(args)...),
+            resource};
+    }
+}
+
+template <typename T>
+    requires(!std::is_array_v<T>)
+struct gimo::traits<gimo::pmr::shared_ptr<T>>
+{
+    static constexpr std::nullptr_t null{};
+
+    template <typename V>
+    using rebind_value = pmr::shared_ptr<V>;
+
+    template <typename Arg>
+        requires std::constructible_from<T, Arg&&>
+    [[nodiscard]]
+    static pmr::shared_ptr<T> from_value(Arg&& arg)
+    {
+        return pmr::make_shared<T>(std::pmr::get_default_resource(), std::forward<Arg>(arg));
+    }
+
+    /**
+     * \brief Allocates the rebound object from the memory-resource of the source.
+     */
+    template <typename V, typename Arg>
+        requires std::constructible_from<V, Arg&&>
+    [[nodiscard]]
+    static pmr::shared_ptr<V> from_value_like(pmr::shared_ptr<T> const& source, Arg&& arg)
+    {
+        return pmr::make_shared<V>(source.resource(), std::forward<Arg>(arg));
+    }
+};
+
+#endif
@@ -8,7 +8,10 @@
 
 #pragma once
 
+#include <concepts>
 #include <expected>
+#include <type_traits>
+#include <utility>
 
 namespace gimo
 {
@@ -44,9 +47,16 @@ struct gimo::traits<std::expected<Value, Error>>
     template <typename E>
     using rebind_error = std::expected<Value, E>;
 
+    [[nodiscard]]
+    static constexpr bool owns_value([[maybe_unused]] expected const& exp) noexcept
+    {
+        return true;
+    }
+
     template <typename E>
         requires std::constructible_from<expected, std::unexpect_t, E&&>
     static constexpr expected from_error(E&& error)
+        noexcept(std::is_nothrow_constructible_v<expected, std::unexpect_t, E&&>)
     {
         return expected{std::unexpect, std::forward<E>(error)};
     }
@@ -23,6 +23,12 @@ struct gimo::traits<std::optional<T>>
 
     template <typename V>
     using rebind_value =  std::optional<V>;
+
+    [[nodiscard]]
+    static constexpr bool owns_value([[maybe_unused]] std::optional<T> const& opt) noexcept
+    {
+        return true;
+    }
 };
 
 #endif
@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include <concepts>
 #include <memory>
+#include <utility>
 
 namespace gimo
 {
@@ -32,6 +34,20 @@ struct gimo::traits<std::shared_ptr<T>>
     {
         return std::make_shared<T>(std::forward<Arg>(arg));
     }
+
+    /**
+     * \brief Allocates the object and its control-block with the given allocator.
+     * \details
+     * The allocator can not be retrieved afterwards; thus, rebinding operations allocate from the global heap.
+     * Use `gimo::pmr::shared_ptr` (see `gimo_ext/Pmr.hpp`), when the memory-resource shall be propagated.
+     */
+    template <typename Allocator, typename Arg>
+        requires std::constructible_from<T, Arg&&>
+    [[nodiscard]]
+    static std::shared_ptr<T> from_value([[maybe_unused]] std::allocator_arg_t const tag, Allocator const& allocator, Arg&& arg)
+    {
+        return std::allocate_shared<T>(allocator, std::forward<Arg>(arg));
+    }
 };
 
 #endif
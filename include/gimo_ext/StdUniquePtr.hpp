@@ -8,12 +8,48 @@
 
 #pragma once
 
+#include <concepts>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace gimo
 {
     template <typename T>
     struct traits;
+
+    namespace detail::deleter
+    {
+        /**
+         * \brief Determines, whether the deleter exposes the allocator, which its objects are allocated with.
+         * \details
+         * Such deleters must provide:
+         * - an `allocator_type` alias and a `get_allocator()` member function,
+         * - a constructor accepting the `allocator_type`,
+         * - and a `rebind<V>` alias to obtain the deleter for other object-types.
+         */
+        template <typename Deleter>
+        concept allocating_deleter = requires(Deleter const& deleter) {
+            typename Deleter::allocator_type;
+            typename Deleter::template rebind<int>;
+            { deleter.get_allocator() } -> std::convertible_to<typename Deleter::allocator_type>;
+            requires std::constructible_from<Deleter, typename Deleter::allocator_type const&>;
+        };
+
+        template <typename Deleter>
+        struct rebinder
+        {
+            template <typename V>
+            using type = std::unique_ptr<V>;
+        };
+
+        template <allocating_deleter Deleter>
+        struct rebinder<Deleter>
+        {
+            template <typename V>
+            using type = std::unique_ptr<V, typename Deleter::template rebind<V>>;
+        };
+    }
 }
 
 template <typename T, typename Deleter>
@@ -36,16 +72,88 @@ struct gimo::traits<std::unique_ptr<T, Deleter>>
         return std::move(*ptr);
     }
 
+    /**
+     * \brief Rebinds the value-type.
+     * \details
+     * Allocating deleters are rebound as well; all other deleters are replaced by `std::default_delete`.
+     */
     template <typename V>
-    using rebind_value = std::unique_ptr<V>;
+    using rebind_value = typename detail::deleter::rebinder<Deleter>::template type<V>;
+
+    /**
+     * \brief Determines, whether the value may be modified in place.
+     * \details
+     * Unavailable for non-final polymorphic types, as the pointer may refer to a derived object,
+     * which would then be sliced during the assignment.
+     */
+    [[nodiscard]]
+    static constexpr bool owns_value([[maybe_unused]] Pointer const& ptr) noexcept
+        requires(!std::is_polymorphic_v<T> || std::is_final_v<T>)
+    {
+        return true;
+    }
 
     template <typename Arg>
         requires std::constructible_from<T, Arg&&>
+              && (!detail::deleter::allocating_deleter<Deleter>)
     [[nodiscard]]
     static constexpr Pointer from_value(Arg&& arg)
     {
         return std::make_unique<T>(std::forward<Arg>(arg));
     }
+
+    template <typename Arg>
+        requires std::constructible_from<T, Arg&&>
+              && detail::deleter::allocating_deleter<Deleter>
+              && std::default_initializable<Deleter>
+    [[nodiscard]]
+    static constexpr Pointer from_value(Arg&& arg)
+    {
+        return from_value(std::allocator_arg, Deleter{}.get_allocator(), std::forward<Arg>(arg));
+    }
+
+    /**
+     * \brief Allocates the object with the given allocator and hands it over to the deleter.
+     */
+    template <typename Allocator, typename Arg>
+        requires std::constructible_from<T, Arg&&>
+              && detail::deleter::allocating_deleter<Deleter>
+              && std::constructible_from<typename Deleter::allocator_type, Allocator const&>
+    [[nodiscard]]
+    static constexpr Pointer from_value([[maybe_unused]] std::allocator_arg_t const tag, Allocator const& allocator, Arg&& arg)
+    {
+        using allocator_type = typename Deleter::allocator_type;
+        using allocator_traits = std::allocator_traits<allocator_type>;
+
+        allocator_type alloc(allocator);
+        auto const ptr = allocator_traits::allocate(alloc, 1u);
+        try
+        {
+            allocator_traits::construct(alloc, std::to_address(ptr), std::forward<Arg>(arg));
+        }
+        catch (...)
+        {
+            allocator_traits::deallocate(alloc, ptr, 1u);
+            throw;
+        }
+
+        return Pointer{std::to_address(ptr), Deleter{alloc}};
+    }
+
+    /**
+     * \brief Allocates the rebound object with the allocator of the source.
+     */
+    template <typename V, typename Arg>
+        requires detail::deleter::allocating_deleter<Deleter>
+              && std::constructible_from<V, Arg&&>
+    [[nodiscard]]
+    static constexpr rebind_value<V> from_value_like(Pointer const& source, Arg&& arg)
+    {
+        return traits<rebind_value<V>>::from_value(
+            std::allocator_arg,
+            source.get_deleter().get_allocator(),
+            std::forward<Arg>(arg));
+    }
 };
 
 #endif
@@ -0,0 +1,203 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_EXT_TAGGED_POINTER_HPP
+#define GIMO_EXT_TAGGED_POINTER_HPP
+
+#pragma once
+
+#include "gimo/Config.hpp"
+
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace gimo
+{
+    template <typename T>
+    struct traits;
+
+    /**
+     * \brief Determines, whether the type can be stored as error-code of a `TaggedPointer`.
+     */
+    template <typename Error>
+    concept tagged_error = std::is_enum_v<Error>
+                        || (std::integral<Error> && !std::same_as<bool, Error>);
+
+    /**
+     * \brief Determines, whether pointers to the type leave their lowest bit unused.
+     */
+    template <typename T>
+    concept taggable = std::is_object_v<T>
+                    && 2u <= alignof(T);
+
+    /**
+     * \brief An expected-like type, which packs either a pointer or an error-code into a single machine-word.
+     * \tparam T The pointee-type. Its alignment must be at least 2.
+     * \tparam Error The error-type. Must be an integral or enum type.
+     * \details
+     * A word with the lowest bit cleared denotes a pointer (which may be `nullptr`).
+     * Otherwise, the remaining bits denote the error-code, which must thus be representable with one bit less than `std::intptr_t`.
+     *
+     * As the type is trivially copyable and as large as a pointer, it's passed via registers.
+     */
+    template <taggable T, tagged_error Error>
+    class TaggedPointer
+    {
+    public:
+        using value_type = T*;
+        using error_type = Error;
+
+        struct null_t
+        {
+            [[nodiscard]]
+            friend constexpr bool operator==(TaggedPointer const ptr, [[maybe_unused]] null_t const tag) noexcept
+            {
+                return !ptr.has_value();
+            }
+
+            [[nodiscard]]
+            explicit(false) constexpr operator TaggedPointer() const noexcept
+            {
+                return TaggedPointer::from_error(Error{});
+            }
+        };
+
+        /**
+         * \brief Creates a null-pointer.
+         */
+        TaggedPointer() = default;
+
+        [[nodiscard]]
+        explicit(false) TaggedPointer(T* const ptr) noexcept
+            : m_Word{reinterpret_cast<std::uintptr_t>(ptr)}
+        {
+            GIMO_ASSERT(0u == (m_Word & errorBit), "Pointer is misaligned.");
+        }
+
+        [[nodiscard]]
+        static constexpr TaggedPointer from_error(Error const error) noexcept
+        {
+            auto const code = static_cast<std::intptr_t>(to_underlying(error));
+            GIMO_ASSERT(
+                code == (code << 1) >> 1,
+                "Error-code exceeds the available bits.");
+
+            TaggedPointer ptr{};
+            ptr.m_Word = (static_cast<std::uintptr_t>(code) << 1u) | errorBit;
+
+            return ptr;
+        }
+
+        [[nodiscard]]
+        constexpr bool has_value() const noexcept
+        {
+            return 0u == (m_Word & errorBit);
+        }
+
+        [[nodiscard]]
+        explicit constexpr operator bool() const noexcept
+        {
+            return has_value();
+        }
+
+        [[nodiscard]]
+        T* value() const noexcept
+        {
+            GIMO_ASSERT(has_value(), "Pointer must not hold an error.");
+
+            return reinterpret_cast<T*>(m_Word);
+        }
+
+        [[nodiscard]]
+        constexpr Error error() const noexcept
+        {
+            GIMO_ASSERT(!has_value(), "Pointer must hold an error.");
+
+            // Right-shifting a negative value is arithmetic since C++20.
+            return static_cast<Error>(static_cast<std::intptr_t>(m_Word) >> 1);
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(TaggedPointer const& lhs, TaggedPointer const& rhs) = default;
+
+    private:
+        static constexpr std::uintptr_t errorBit{1u};
+
+        std::uintptr_t m_Word{};
+
+        [[nodiscard]]
+        static constexpr auto to_underlying(Error const error) noexcept
+        {
+            if constexpr (std::is_enum_v<Error>)
+            {
+                return static_cast<std::underlying_type_t<Error>>(error);
+            }
+            else
+            {
+                return error;
+            }
+        }
+    };
+
+    namespace detail::tagged_pointer
+    {
+        struct Probe
+        {
+            int value;
+        };
+
+        static_assert(sizeof(void*) == sizeof(TaggedPointer<Probe, int>));
+        static_assert(alignof(void*) == alignof(TaggedPointer<Probe, int>));
+        static_assert(std::is_trivially_copyable_v<TaggedPointer<Probe, int>>);
+
+        template <typename V, typename Error>
+        struct rebinder;
+
+        template <taggable T, typename Error>
+        struct rebinder<T*, Error>
+        {
+            using type = TaggedPointer<T, Error>;
+        };
+    }
+}
+
+/**
+ * \details
+ * The value-type can only be rebound to pointers, whose pointee-type is suitably aligned.
+ */
+template <typename T, typename Error>
+struct gimo::traits<gimo::TaggedPointer<T, Error>>
+{
+    using pointer = TaggedPointer<T, Error>;
+
+    static constexpr typename pointer::null_t null{};
+
+    [[nodiscard]]
+    static T* value(pointer const ptr) noexcept
+    {
+        return ptr.value();
+    }
+
+    [[nodiscard]]
+    static constexpr Error error(pointer const ptr) noexcept
+    {
+        return ptr.error();
+    }
+
+    template <typename V>
+    using rebind_value = typename detail::tagged_pointer::rebinder<V, Error>::type;
+
+    template <typename E>
+    using rebind_error = TaggedPointer<T, E>;
+
+    [[nodiscard]]
+    static constexpr pointer from_error(Error const error) noexcept
+    {
+        return pointer::from_error(error);
+    }
+};
+
+#endif
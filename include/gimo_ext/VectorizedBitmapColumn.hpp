@@ -0,0 +1,350 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef GIMO_EXT_VECTORIZED_BITMAP_COLUMN_HPP
+#define GIMO_EXT_VECTORIZED_BITMAP_COLUMN_HPP
+
+#pragma once
+
+#include "gimo/Batch.hpp"
+#include "gimo/Common.hpp"
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo/algorithm/ValueOrElse.hpp"
+#include "gimo_ext/BitmapColumn.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<experimental/simd>)
+    #include <experimental/simd>
+#endif
+
+namespace gimo
+{
+    /**
+     * \brief Tag type, which requests the vectorized execution of a pipeline over a column.
+     */
+    struct vectorized_t
+    {
+        explicit vectorized_t() = default;
+    };
+
+    /**
+     * \brief Tag object, which requests the vectorized execution of a pipeline over a column.
+     */
+    inline constexpr vectorized_t vectorized{};
+
+    namespace detail::bitmap_column
+    {
+        /**
+         * \brief The nullable, which carries multiple values through the pipeline at once.
+         * \details
+         * The lanes are always treated as engaged; their actual validity is applied after the pipeline has finished.
+         */
+        template <typename V>
+        class Lanes
+        {
+        public:
+            [[nodiscard]]
+            explicit constexpr Lanes(V value) noexcept(std::is_nothrow_move_constructible_v<V>)
+                : m_Value{std::move(value)},
+                  m_IsEngaged{true}
+            {
+            }
+
+            [[nodiscard]]
+            explicit(false) constexpr Lanes([[maybe_unused]] std::nullptr_t const null) noexcept(std::is_nothrow_default_constructible_v<V>)
+            {
+            }
+
+            [[nodiscard]]
+            constexpr V const& operator*() const& noexcept
+            {
+                return m_Value;
+            }
+
+            [[nodiscard]]
+            constexpr V&& operator*() && noexcept
+            {
+                return std::move(m_Value);
+            }
+
+            [[nodiscard]]
+            constexpr bool operator==([[maybe_unused]] std::nullptr_t const null) const noexcept
+            {
+                return !m_IsEngaged;
+            }
+
+        private:
+            V m_Value{};
+            bool m_IsEngaged{false};
+        };
+    }
+
+    template <typename V>
+    struct traits<detail::bitmap_column::Lanes<V>>
+    {
+        static constexpr std::nullptr_t null{};
+        static constexpr bool always_engaged{true};
+
+        template <typename U>
+        using rebind_value = detail::bitmap_column::Lanes<U>;
+    };
+
+    namespace detail::bitmap_column
+    {
+        template <typename Step>
+        struct is_vectorizable_step
+            : public std::false_type
+        {
+        };
+
+        template <typename Action>
+        struct is_vectorizable_step<BasicAlgorithm<transform::traits, Action>>
+            : public std::true_type
+        {
+        };
+
+        template <typename T>
+        struct is_vectorizable_step<BasicAlgorithm<value_or_else::traits, ValueStorageFun<T>>>
+            : public std::true_type
+        {
+        };
+
+        template <typename Pipeline>
+        struct is_vectorizable_pipeline
+            : public std::false_type
+        {
+        };
+
+        template <typename... Steps>
+        struct is_vectorizable_pipeline<Pipeline<Steps...>>
+            : public std::bool_constant<(is_vectorizable_step<Steps>::value && ...)>
+        {
+        };
+
+        /**
+         * \brief Determines, whether the pipeline consists solely of `transform` and `value_or` steps,
+         * operating on trivially copyable values.
+         */
+        template <typename T, typename Pipeline>
+        concept vectorizable = is_vectorizable_pipeline<std::remove_cvref_t<Pipeline>>::value
+                            && std::is_trivially_copyable_v<T>
+                            && std::is_trivially_copyable_v<column_value_t<T, Pipeline>>
+                            && processable_by<ValidCell<T>, Pipeline const&>;
+
+        template <typename T, typename Pipeline>
+        inline constexpr bool is_terminating{!nullable<apply_result_t<std::optional<T>, Pipeline>>};
+
+        template <typename Result>
+        struct lanes_value
+        {
+            using type = Result;
+        };
+
+        template <typename V>
+        struct lanes_value<Lanes<V>>
+        {
+            using type = V;
+        };
+
+        template <typename Result>
+        [[nodiscard]]
+        constexpr auto unwrap_lanes(Result&& result)
+        {
+            if constexpr (nullable<Result>)
+            {
+                return detail::forward_value<Result>(result);
+            }
+            else
+            {
+                return std::forward<Result>(result);
+            }
+        }
+
+#ifdef __cpp_lib_experimental_parallel_simd
+        namespace stdx = std::experimental;
+
+        template <typename T>
+        using simd_t = stdx::native_simd<T>;
+
+        template <typename T, typename Pipeline>
+        using simd_result_t = typename lanes_value<apply_result_t<Lanes<simd_t<T>>, Pipeline>>::type;
+
+        /**
+         * \brief Determines, whether each action of the pipeline accepts whole simd-registers.
+         */
+        template <typename T, typename Pipeline>
+        concept simd_applicable = std::is_arithmetic_v<T>
+                               && std::is_arithmetic_v<column_value_t<T, Pipeline>>
+                               && simd_t<T>::size() <= BitmapColumnView<T>::word_bits
+                               && processable_by<Lanes<simd_t<T>>, Pipeline const&>
+                               && requires {
+                                      requires stdx::is_simd_v<simd_result_t<T, Pipeline>>;
+                                      requires std::same_as<column_value_t<T, Pipeline>, typename simd_result_t<T, Pipeline>::value_type>;
+                                      requires simd_t<T>::size() == simd_result_t<T, Pipeline>::size();
+                                  };
+
+        /**
+         * \brief Processes as many full simd-registers as possible.
+         * \return The number of processed elements.
+         */
+        template <typename T, typename Pipeline, typename Value, typename Alternative>
+        std::size_t apply_simd(
+            BitmapColumnView<T> const column,
+            Pipeline const& steps,
+            std::span<Value> const output,
+            [[maybe_unused]] Alternative const& alternative)
+        {
+            using Input = simd_t<T>;
+            using Result = simd_result_t<T, Pipeline>;
+            constexpr std::size_t width = Input::size();
+
+            std::span const input = column.values();
+            std::size_t index{0u};
+            for (; index + width <= column.size(); index += width)
+            {
+                Result result = bitmap_column::unwrap_lanes(
+                    steps.apply(Lanes<Input>{Input{&input[index], stdx::element_aligned}}));
+
+                if constexpr (is_terminating<T, Pipeline>)
+                {
+                    bool flags[width];
+                    std::uint64_t const word = column.validity()[index / BitmapColumnView<T>::word_bits];
+                    std::size_t const shift = index % BitmapColumnView<T>::word_bits;
+                    for (std::size_t lane{0u}; lane < width; ++lane)
+                    {
+                        flags[lane] = 0u != ((word >> (shift + lane)) & 1u);
+                    }
+
+                    typename Result::mask_type const valid{flags, stdx::element_aligned};
+                    stdx::where(!valid, result) = alternative;
+                }
+
+                result.copy_to(&output[index], stdx::element_aligned);
+            }
+
+            return index;
+        }
+#endif
+
+        template <typename T, typename Pipeline, typename Value, typename Alternative>
+        constexpr void apply_branchless(
+            BitmapColumnView<T> const column,
+            Pipeline const& steps,
+            std::span<Value> const output,
+            [[maybe_unused]] Alternative const& alternative,
+            std::size_t const first)
+        {
+            std::span const input = column.values();
+            for (std::size_t i{first}; i < column.size(); ++i)
+            {
+                Value value = bitmap_column::unwrap_lanes(steps.apply(ValidCell<T>{input[i]}));
+                if constexpr (is_terminating<T, Pipeline>)
+                {
+                    output[i] = column.is_valid(i) ? value : alternative;
+                }
+                else
+                {
+                    output[i] = value;
+                }
+            }
+        }
+    }
+
+    /**
+     * \brief Applies each element of the column on the pipeline and collects the results in a new column,
+     * without any per-element branches.
+     * \tparam T The value-type of the source column.
+     * \tparam Pipeline The pipeline type.
+     * \param column The source column.
+     * \param pipeline The pipeline to execute for each element.
+     * \return A new column, whose validity reflects the null-state of the results.
+     * \details
+     * This is applicable on pipelines, which consist solely of `transform` steps, optionally terminated by `value_or`,
+     * and which operate on trivially copyable values. In that case, the actions are applied on *every* value-slot,
+     * including the invalid ones, and the alternative is blended into the results afterwards.
+     * Therefore, the caller must ensure that each action is free of side effects and well-defined for every slot content.
+     *
+     * When `std::experimental::simd` is available and each action is invocable with a whole simd-register
+     * (e.g. generic lambdas performing plain arithmetic), multiple elements are processed at once.
+     * Otherwise, a branchless scalar loop is used, which the compiler may vectorize on its own.
+     *
+     * All other pipelines are executed by the regular `apply_each`.
+     */
+    template <typename T, pipeline Pipeline>
+        requires requires(BitmapColumnView<T> const column, Pipeline const& pipeline) {
+            gimo::apply_each(column, pipeline);
+        }
+    [[nodiscard]]
+    constexpr auto apply_each([[maybe_unused]] vectorized_t const tag, BitmapColumnView<T> const column, Pipeline const& pipeline)
+    {
+        if constexpr (detail::bitmap_column::vectorizable<T, Pipeline>)
+        {
+            using View = BitmapColumnView<T>;
+            using Value = detail::column_value_t<T, Pipeline>;
+            constexpr bool isTerminating = detail::bitmap_column::is_terminating<T, Pipeline>;
+
+            // Bound as const, so that the `const&` overload of `apply` is used, which the constraints check for.
+            auto const& steps = detail::hoist_pipeline(pipeline);
+            std::size_t const size = column.size();
+            BitmapColumn<Value> result(size);
+
+            Value alternative{};
+            if constexpr (isTerminating)
+            {
+                alternative = steps.apply(std::optional<T>{});
+            }
+
+            std::size_t processed{0u};
+#ifdef __cpp_lib_experimental_parallel_simd
+            if constexpr (detail::bitmap_column::simd_applicable<T, Pipeline>)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    processed = detail::bitmap_column::apply_simd(column, steps, result.values(), alternative);
+                }
+            }
+#endif
+            detail::bitmap_column::apply_branchless(column, steps, result.values(), alternative, processed);
+
+            for (std::size_t word{0u}; word < View::word_count(size); ++word)
+            {
+                std::size_t const count = size - word * View::word_bits;
+                std::uint64_t const mask = View::word_bits <= count
+                                             ? ~std::uint64_t{0u}
+                                             : (std::uint64_t{1u} << count) - 1u;
+                result.validity()[word] = isTerminating ? mask : column.validity()[word] & mask;
+            }
+
+            return result;
+        }
+        else
+        {
+            return gimo::apply_each(column, pipeline);
+        }
+    }
+
+    /**
+     * \copydoc apply_each(vectorized_t, BitmapColumnView<T>, Pipeline const&)
+     */
+    template <typename T, pipeline Pipeline>
+        requires requires(BitmapColumnView<T> const column, Pipeline const& pipeline) {
+            gimo::apply_each(vectorized, column, pipeline);
+        }
+    [[nodiscard]]
+    constexpr auto apply_each(vectorized_t const tag, BitmapColumn<T> const& column, Pipeline const& pipeline)
+    {
+        return gimo::apply_each(tag, column.view(), pipeline);
+    }
+}
+
+#endif
@@ -0,0 +1,31 @@
+#          Copyright Dominic (DNKpp) Koepke 2026.
+# Distributed under the Boost Software License, Version 1.0.
+#    (See accompanying file LICENSE_1_0.txt or copy at
+#          https://www.boost.org/LICENSE_1_0.txt)
+
+# Builds the given target and checks whether its object-file contains exception-tables (i.e. landing-pads).
+# Expects the variables BINARY_DIR, TARGET, OBJECT_FILE, OBJDUMP and EXPECT_LANDING_PADS.
+
+execute_process(
+    COMMAND ${CMAKE_COMMAND} --build ${BINARY_DIR} --target ${TARGET}
+    RESULT_VARIABLE BUILD_RESULT
+)
+if (NOT BUILD_RESULT EQUAL 0)
+    message(FATAL_ERROR "Building ${TARGET} failed.")
+endif ()
+
+execute_process(
+    COMMAND ${OBJDUMP} --section-headers ${OBJECT_FILE}
+    OUTPUT_VARIABLE SECTION_HEADERS
+    RESULT_VARIABLE OBJDUMP_RESULT
+)
+if (NOT OBJDUMP_RESULT EQUAL 0)
+    message(FATAL_ERROR "Reading the section-headers of ${OBJECT_FILE} failed.")
+endif ()
+
+string(FIND "${SECTION_HEADERS}" ".gcc_except_table" EXCEPT_TABLE_POSITION)
+if (EXPECT_LANDING_PADS AND EXCEPT_TABLE_POSITION EQUAL -1)
+    message(FATAL_ERROR "${TARGET}: Expected landing-pads, but the object-file contains no .gcc_except_table section.")
+elseif (NOT EXPECT_LANDING_PADS AND NOT EXCEPT_TABLE_POSITION EQUAL -1)
+    message(FATAL_ERROR "${TARGET}: Expected no landing-pads, but the object-file contains a .gcc_except_table section.")
+endif ()
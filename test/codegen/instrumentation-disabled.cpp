@@ -0,0 +1,42 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Instrumentation.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include <chrono>
+#include <concepts>
+#include <optional>
+
+static_assert(0 == GIMO_INSTRUMENT, "This case must be compiled with instrumentation disabled.");
+
+namespace
+{
+    auto const plain = gimo::transform([](int const value) noexcept { return value + 1; })
+                     | gimo::and_then([](int const value) { return 0 < value ? std::optional{value} : std::nullopt; })
+                     | gimo::or_else([] { return std::optional{-1}; });
+
+    gimo::CounterSink<std::chrono::steady_clock> sink{3u};
+    auto const instrumented = gimo::instrumented(plain, sink);
+
+    // The instrumented pipeline is the plain one; thus both instantiate the very same code.
+    static_assert(std::same_as<decltype(plain), decltype(instrumented)>);
+    static_assert(sizeof(plain) == sizeof(instrumented));
+}
+
+[[nodiscard]]
+std::optional<int> process_plain(std::optional<int> const opt)
+{
+    return plain.apply(opt);
+}
+
+[[nodiscard]]
+std::optional<int> process_instrumented(std::optional<int> const opt)
+{
+    return instrumented.apply(opt);
+}
@@ -0,0 +1,66 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Pipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include <optional>
+
+#ifndef GIMO_CODEGEN_NOTHROW
+    #error "GIMO_CODEGEN_NOTHROW must be defined as either 0 or 1."
+#endif
+
+namespace
+{
+    [[nodiscard]]
+    int increment(int const value) noexcept
+    {
+        return value + 1;
+    }
+
+    void release() noexcept
+    {
+    }
+
+    // Calls through a `volatile` function-pointer can neither be inlined nor have their exception-specification deduced.
+    int (*volatile operation)(int) noexcept(GIMO_CODEGEN_NOTHROW) = &increment;
+    void (*volatile releaser)() noexcept = &release;
+
+    constexpr auto pipeline = gimo::transform([](int const value) noexcept(GIMO_CODEGEN_NOTHROW) { return operation(value); })
+                            | gimo::and_then([](int const value) noexcept(GIMO_CODEGEN_NOTHROW) -> std::optional<int> {
+                                  if (value % 97 == 0)
+                                  {
+                                      return std::nullopt;
+                                  }
+
+                                  return operation(value);
+                              });
+
+    // The boundary takes its exception-specification solely from the library.
+    // As the compiler can not look through it, this is all it knows about the potential exceptions.
+    constexpr auto apply = [](std::optional<int> const& opt) noexcept(noexcept(pipeline.apply(opt))) {
+        return pipeline.apply(opt);
+    };
+    std::optional<int> (*volatile applier)(std::optional<int> const&) noexcept(noexcept(apply(std::optional<int>{}))) = apply;
+
+    struct Resource
+    {
+        ~Resource() noexcept
+        {
+            releaser();
+        }
+    };
+}
+
+// As this function is not `noexcept`, a landing-pad is only required to release the resource,
+// when the pipeline is potentially throwing.
+[[nodiscard]]
+std::optional<int> process(std::optional<int> const& opt)
+{
+    Resource const resource{};
+    return applier(opt);
+}
@@ -0,0 +1,41 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Tracing.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include <concepts>
+#include <optional>
+
+static_assert(0 == GIMO_TRACE, "This case must be compiled with tracing disabled.");
+
+namespace
+{
+    auto const plain = gimo::transform([](int const value) noexcept { return value + 1; })
+                     | gimo::and_then([](int const value) { return 0 < value ? std::optional{value} : std::nullopt; })
+                     | gimo::or_else([] { return std::optional{-1}; });
+
+    gimo::TraceSink sink{};
+    auto const traced = gimo::traced(plain, sink);
+
+    // The traced pipeline is the plain one; thus both instantiate the very same code.
+    static_assert(std::same_as<decltype(plain), decltype(traced)>);
+    static_assert(sizeof(plain) == sizeof(traced));
+}
+
+[[nodiscard]]
+std::optional<int> process_plain(std::optional<int> const opt)
+{
+    return plain.apply(opt);
+}
+
+[[nodiscard]]
+std::optional<int> process_traced(std::optional<int> const opt)
+{
+    return traced.apply(opt);
+}
@@ -0,0 +1,241 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/AnyPipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include "TestCommons.hpp"
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr auto pipeline = gimo::transform([](int const value) noexcept { return value * 2; })
+                            | gimo::and_then([](int const value) noexcept -> std::optional<float> {
+                                  if (value < 0)
+                                  {
+                                      return std::nullopt;
+                                  }
+
+                                  return static_cast<float>(value) + 0.5f;
+                              });
+
+    /**
+     * \brief Creates a pipeline, which is too large for the in-place storage.
+     */
+    [[nodiscard]]
+    auto make_large_pipeline(int const offset)
+    {
+        std::array<int, 16u> offsets{};
+        offsets.back() = offset;
+
+        return gimo::transform([offsets](int const value) noexcept { return value + offsets.back(); });
+    }
+
+    using AnyOptPipeline = gimo::AnyPipeline<std::optional<int> const&, std::optional<float>>;
+    using MoveOnlyOptPipeline = gimo::MoveOnlyAnyPipeline<std::optional<int>, std::optional<int>>;
+}
+
+TEMPLATE_TEST_CASE(
+    "AnyPipeline variants are nothrow movable.",
+    "[pipeline]",
+    AnyOptPipeline,
+    MoveOnlyOptPipeline)
+{
+    STATIC_CHECK(std::is_nothrow_default_constructible_v<TestType>);
+    STATIC_CHECK(std::is_nothrow_move_constructible_v<TestType>);
+    STATIC_CHECK(std::is_nothrow_move_assignable_v<TestType>);
+    STATIC_CHECK(std::is_nothrow_destructible_v<TestType>);
+}
+
+TEST_CASE(
+    "AnyPipeline is copyable, but MoveOnlyAnyPipeline is not.",
+    "[pipeline]")
+{
+    STATIC_CHECK(std::is_copy_constructible_v<AnyOptPipeline>);
+    STATIC_CHECK(std::is_copy_assignable_v<AnyOptPipeline>);
+
+    STATIC_CHECK_FALSE(std::is_copy_constructible_v<MoveOnlyOptPipeline>);
+    STATIC_CHECK_FALSE(std::is_copy_assignable_v<MoveOnlyOptPipeline>);
+}
+
+TEST_CASE(
+    "AnyPipeline accepts only pipelines, which are processable with the input and convertible to the output.",
+    "[pipeline]")
+{
+    STATIC_CHECK(std::is_convertible_v<decltype(pipeline), AnyOptPipeline>);
+    STATIC_CHECK(std::is_convertible_v<decltype(pipeline) const&, AnyOptPipeline>);
+
+    STATIC_CHECK_FALSE(std::is_constructible_v<gimo::AnyPipeline<std::optional<std::string>, std::optional<float>>, decltype(pipeline)>);
+    STATIC_CHECK_FALSE(std::is_constructible_v<gimo::AnyPipeline<std::optional<int>, std::string>, decltype(pipeline)>);
+    STATIC_CHECK_FALSE(std::is_constructible_v<AnyOptPipeline, int>);
+
+    SECTION("And copyable variants require copyable pipelines.")
+    {
+        using MoveOnlyPipeline = decltype(gimo::transform([ptr = std::unique_ptr<int>{}](int const value) noexcept { return value; }));
+
+        STATIC_CHECK_FALSE(std::is_constructible_v<gimo::AnyPipeline<std::optional<int>, std::optional<int>>, MoveOnlyPipeline>);
+        STATIC_CHECK(std::is_constructible_v<MoveOnlyOptPipeline, MoveOnlyPipeline>);
+    }
+}
+
+TEST_CASE(
+    "A default-constructed AnyPipeline is empty.",
+    "[pipeline]")
+{
+    AnyOptPipeline const any{};
+
+    CHECK_FALSE(any);
+}
+
+TEST_CASE(
+    "AnyPipeline applies the input on the stored pipeline.",
+    "[pipeline]")
+{
+    AnyOptPipeline const any{pipeline};
+    REQUIRE(any);
+
+    CHECK(std::optional{42.5f} == any.apply(std::optional{21}));
+    CHECK(std::nullopt == any.apply(std::optional{-1}));
+    CHECK(std::nullopt == any.apply(std::nullopt));
+}
+
+TEST_CASE(
+    "AnyPipeline stores large pipelines on the heap.",
+    "[pipeline]")
+{
+    using Any = gimo::AnyPipeline<std::optional<int>, std::optional<int>>;
+    STATIC_CHECK(gimo::anyPipelineBufferSize < sizeof(decltype(make_large_pipeline(0))));
+
+    Any source{make_large_pipeline(42)};
+
+    SECTION("When applied.")
+    {
+        CHECK(std::optional{43} == source.apply(1));
+    }
+
+    SECTION("When copied.")
+    {
+        Any const copy{source};
+
+        CHECK(source);
+        CHECK(std::optional{43} == source.apply(1));
+        CHECK(std::optional{43} == copy.apply(1));
+    }
+
+    SECTION("When moved.")
+    {
+        Any const target{std::move(source)};
+
+        CHECK_FALSE(source);
+        CHECK(std::optional{43} == target.apply(1));
+    }
+
+    SECTION("When assigned.")
+    {
+        Any target{make_large_pipeline(-1)};
+
+        target = source;
+        CHECK(std::optional{43} == target.apply(1));
+
+        target = Any{make_large_pipeline(1)};
+        CHECK(std::optional{2} == target.apply(1));
+    }
+}
+
+TEST_CASE(
+    "AnyPipeline can be copied and moved.",
+    "[pipeline]")
+{
+    AnyOptPipeline source{pipeline};
+
+    SECTION("When copy-constructed.")
+    {
+        AnyOptPipeline const copy{source};
+
+        CHECK(source);
+        CHECK(std::optional{42.5f} == copy.apply(std::optional{21}));
+    }
+
+    SECTION("When copy-assigned.")
+    {
+        AnyOptPipeline target{};
+        target = source;
+
+        CHECK(source);
+        CHECK(std::optional{42.5f} == target.apply(std::optional{21}));
+    }
+
+    SECTION("When move-constructed.")
+    {
+        AnyOptPipeline const target{std::move(source)};
+
+        CHECK_FALSE(source);
+        CHECK(std::optional{42.5f} == target.apply(std::optional{21}));
+    }
+
+    SECTION("When move-assigned.")
+    {
+        AnyOptPipeline target{pipeline};
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        CHECK(std::optional{42.5f} == target.apply(std::optional{21}));
+    }
+
+    SECTION("When an empty wrapper is assigned.")
+    {
+        source = AnyOptPipeline{};
+
+        CHECK_FALSE(source);
+    }
+}
+
+TEST_CASE(
+    "MoveOnlyAnyPipeline can store move-only pipelines.",
+    "[pipeline]")
+{
+    auto step = gimo::and_then([ptr = std::make_unique<int>(42)](int const value) -> std::optional<int> {
+        if (value < 0)
+        {
+            return std::nullopt;
+        }
+
+        return value + *ptr;
+    });
+
+    MoveOnlyOptPipeline source{std::move(step)};
+    MoveOnlyOptPipeline const target{std::move(source)};
+
+    CHECK_FALSE(source);
+    CHECK(std::optional{43} == target.apply(1));
+    CHECK(std::nullopt == target.apply(-1));
+    CHECK(std::nullopt == target.apply(std::nullopt));
+}
+
+TEST_CASE(
+    "AnyPipeline allows storing different pipelines in a homogeneous container.",
+    "[pipeline]")
+{
+    using Any = gimo::AnyPipeline<std::optional<int> const&, std::optional<int>>;
+
+    std::vector<Any> routes{};
+    routes.emplace_back(gimo::transform([](int const value) noexcept { return value + 1; }));
+    routes.emplace_back(gimo::and_then([](int const value) noexcept -> std::optional<int> { return value * 2; }));
+    routes.emplace_back(make_large_pipeline(-1));
+
+    std::optional const input{21};
+    CHECK(std::optional{22} == routes[0].apply(input));
+    CHECK(std::optional{42} == routes[1].apply(input));
+    CHECK(std::optional{20} == routes[2].apply(input));
+}
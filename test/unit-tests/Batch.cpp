@@ -0,0 +1,226 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Batch.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include "TestCommons.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr auto pipeline = gimo::transform([](int const value) noexcept { return value * 2; })
+                            | gimo::and_then([](int const value) noexcept -> std::optional<float> {
+                                  if (value < 0)
+                                  {
+                                      return std::nullopt;
+                                  }
+
+                                  return static_cast<float>(value) + 0.5f;
+                              });
+
+    template <typename Range, typename Out>
+    concept can_apply_each = requires(Range&& range, Out out) {
+        gimo::apply_each(std::forward<Range>(range), pipeline, std::move(out));
+    };
+
+    template <typename Range, typename ValueOut, typename ErrorOut>
+    concept can_partition_each = requires(Range&& range, ValueOut values, ErrorOut errors) {
+        gimo::partition_each(std::forward<Range>(range), pipeline, std::move(values), std::move(errors));
+    };
+}
+
+TEST_CASE(
+    "apply_each applies each element of a contiguous range on the pipeline.",
+    "[pipeline]")
+{
+    std::vector<std::optional<int>> const inputs{1, std::nullopt, -1, 42};
+    std::array<std::optional<float>, 4u> outputs{};
+
+    auto const [in, out] = gimo::apply_each(inputs, pipeline, outputs.begin());
+
+    CHECK(in == inputs.cend());
+    CHECK(out == outputs.cend());
+    CHECK(std::optional{2.5f} == outputs[0]);
+    CHECK(std::nullopt == outputs[1]);
+    CHECK(std::nullopt == outputs[2]);
+    CHECK(std::optional{84.5f} == outputs[3]);
+}
+
+TEST_CASE(
+    "apply_each supports arbitrary input-ranges and output-iterators.",
+    "[pipeline]")
+{
+    std::list<std::optional<int>> const inputs{1, std::nullopt, 42};
+    std::vector<std::optional<float>> outputs{};
+
+    auto const [in, out] = gimo::apply_each(inputs, pipeline, std::back_inserter(outputs));
+
+    CHECK(in == inputs.cend());
+    CHECK(outputs == std::vector<std::optional<float>>{2.5f, std::nullopt, 84.5f});
+}
+
+TEST_CASE(
+    "apply_each does nothing on empty ranges.",
+    "[pipeline]")
+{
+    std::vector<std::optional<int>> const inputs{};
+    std::vector<std::optional<float>> outputs{};
+
+    auto const [in, out] = gimo::apply_each(inputs, pipeline, outputs.begin());
+
+    CHECK(in == inputs.cend());
+    CHECK(out == outputs.cend());
+}
+
+TEST_CASE(
+    "apply_each applies the pipeline as const object.",
+    "[pipeline]")
+{
+    struct Action
+    {
+        [[nodiscard]]
+        int operator()([[maybe_unused]] int const value) const noexcept
+        {
+            return 1;
+        }
+
+        [[nodiscard]]
+        int operator()([[maybe_unused]] int const value) noexcept
+        {
+            return 2;
+        }
+    };
+
+    STATIC_REQUIRE(std::is_trivially_copyable_v<decltype(gimo::transform(Action{}))>);
+
+    std::vector<std::optional<int>> const inputs{1, 2};
+    std::vector<std::optional<int>> outputs{};
+
+    gimo::apply_each(inputs, gimo::transform(Action{}), std::back_inserter(outputs));
+
+    CHECK(outputs == std::vector<std::optional<int>>{1, 1});
+}
+
+TEST_CASE(
+    "apply_each is usable during constant evaluation.",
+    "[pipeline]")
+{
+    constexpr auto sum = [] {
+        std::array<std::optional<int>, 3u> const inputs{1, std::nullopt, 3};
+        std::array<std::optional<float>, 3u> outputs{};
+        gimo::apply_each(inputs, pipeline, outputs.begin());
+
+        float result{};
+        for (auto const& output : outputs)
+        {
+            result += output.value_or(0.f);
+        }
+
+        return result;
+    }();
+
+    STATIC_CHECK(9.f == sum);
+}
+
+TEST_CASE(
+    "apply_each requires a processable element-type and a writable output.",
+    "[pipeline]")
+{
+    using Outputs = std::vector<std::optional<float>>;
+
+    STATIC_CHECK(can_apply_each<std::vector<std::optional<int>>&, Outputs::iterator>);
+    STATIC_CHECK(!can_apply_each<std::vector<int>&, Outputs::iterator>);
+    STATIC_CHECK(!can_apply_each<std::vector<std::optional<int>>&, Outputs::const_iterator>);
+}
+
+TEST_CASE(
+    "partition_each writes the values and errors of the results into separate outputs.",
+    "[pipeline]")
+{
+    using Expected = gimo::testing::ExpectedFake<int, std::string>;
+
+    constexpr auto partitioning = gimo::transform([](int const value) { return value * 2; })
+                                | gimo::and_then([](int const value) {
+                                      if (value % 3 == 0)
+                                      {
+                                          return Expected::from_error("divisible: " + std::to_string(value));
+                                      }
+
+                                      return Expected{value};
+                                  });
+
+    std::vector const inputs{
+        Expected{1},
+        Expected::from_error("error"),
+        Expected{3},
+        Expected{4}};
+
+    SECTION("When writing to output-iterators.")
+    {
+        std::vector<int> values{};
+        std::vector<std::string> errors{};
+
+        auto const result = gimo::partition_each(
+            inputs,
+            partitioning,
+            std::back_inserter(values),
+            std::back_inserter(errors));
+
+        CHECK(result.in == inputs.cend());
+        CHECK(2u == result.valueCount);
+        CHECK(2u == result.errorCount);
+        CHECK(values == std::vector{2, 8});
+        CHECK(errors == std::vector<std::string>{"error", "divisible: 6"});
+    }
+
+    SECTION("When writing to pre-sized outputs.")
+    {
+        std::array<int, 4u> values{};
+        std::array<std::string, 4u> errors{};
+
+        auto const result = gimo::partition_each(inputs, partitioning, values.begin(), errors.begin());
+
+        CHECK(result.in == inputs.cend());
+        CHECK(result.values == values.cbegin() + 2);
+        CHECK(result.errors == errors.cbegin() + 2);
+        CHECK(2u == result.valueCount);
+        CHECK(2u == result.errorCount);
+    }
+}
+
+TEST_CASE(
+    "partition_each requires an expected-like result, when an error-output is given.",
+    "[pipeline]")
+{
+    STATIC_CHECK(!can_partition_each<std::vector<std::optional<int>> const&, std::vector<float>::iterator, std::vector<int>::iterator>);
+}
+
+TEST_CASE(
+    "partition_each writes the values of optional-like results and counts the nulls.",
+    "[pipeline]")
+{
+    std::vector<std::optional<int>> const inputs{1, std::nullopt, -1, 42};
+
+    std::vector<float> values{};
+    auto const result = gimo::partition_each(inputs, pipeline, std::back_inserter(values));
+
+    CHECK(result.in == inputs.cend());
+    CHECK(2u == result.valueCount);
+    CHECK(2u == result.nullCount);
+    CHECK(values == std::vector{2.5f, 84.5f});
+}
@@ -0,0 +1,150 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Coroutine.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include "TestCommons.hpp"
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    using gimo::testing::ExpectedFake;
+
+    [[nodiscard]]
+    gimo::Coroutine<std::optional<int>> sum(std::optional<int> const& lhs, std::optional<int> const& rhs, int& visitedSteps)
+    {
+        int const first = co_await lhs;
+        ++visitedSteps;
+        int const second = co_await rhs;
+        ++visitedSteps;
+
+        co_return first + second;
+    }
+
+    [[nodiscard]]
+    gimo::Coroutine<ExpectedFake<std::size_t>> length(ExpectedFake<int> input)
+    {
+        int const value = co_await std::move(input);
+        std::string const str = co_await ExpectedFake<std::string>{std::to_string(value)};
+
+        co_return str.size();
+    }
+}
+
+TEST_CASE(
+    "Coroutine returns the co_returned value, when no nullable is null.",
+    "[coroutine]")
+{
+    int visitedSteps{};
+    std::optional<int> const result = sum(std::optional{42}, std::optional{1337}, visitedSteps);
+
+    CHECK(42 + 1337 == result);
+    CHECK(2 == visitedSteps);
+}
+
+TEST_CASE(
+    "Coroutine short-circuits on the first null.",
+    "[coroutine]")
+{
+    int visitedSteps{};
+
+    SECTION("When the first awaited nullable is null.")
+    {
+        std::optional<int> const result = sum(std::nullopt, std::optional{1337}, visitedSteps);
+
+        CHECK(std::nullopt == result);
+        CHECK(0 == visitedSteps);
+    }
+
+    SECTION("When the second awaited nullable is null.")
+    {
+        std::optional<int> const result = sum(std::optional{42}, std::nullopt, visitedSteps);
+
+        CHECK(std::nullopt == result);
+        CHECK(1 == visitedSteps);
+    }
+}
+
+TEST_CASE(
+    "Coroutine propagates the error of expected-like nullables.",
+    "[coroutine]")
+{
+    SECTION("When no error occurs.")
+    {
+        ExpectedFake<std::size_t> const result = length(ExpectedFake{1337});
+
+        REQUIRE(result);
+        CHECK(4u == *result);
+    }
+
+    SECTION("When an error occurs.")
+    {
+        ExpectedFake<std::size_t> const result = length(ExpectedFake<int>::from_error("An error."));
+
+        REQUIRE(!result);
+        CHECK_THAT(
+            result.error(),
+            Catch::Matchers::Equals("An error."));
+    }
+}
+
+TEST_CASE(
+    "Coroutine yields references to the value of awaited lvalues.",
+    "[coroutine]")
+{
+    std::optional<int> input{42};
+    auto coroutine = [](std::optional<int>& opt) -> gimo::Coroutine<std::optional<int*>> {
+        int& value = co_await opt;
+        co_return &value;
+    };
+
+    std::optional<int*> const result = coroutine(input);
+
+    REQUIRE(result);
+    CHECK(&*input == *result);
+}
+
+TEST_CASE(
+    "Coroutine moves the value out of awaited rvalues.",
+    "[coroutine]")
+{
+    auto coroutine = [](std::optional<std::unique_ptr<int>> opt) -> gimo::Coroutine<std::optional<int>> {
+        decltype(auto) ptr = co_await std::move(opt);
+        STATIC_CHECK(std::same_as<std::unique_ptr<int>, decltype(ptr)>);
+
+        co_return *ptr;
+    };
+
+    std::optional<int> const result = coroutine(std::make_unique<int>(42));
+
+    CHECK(42 == result);
+}
+
+TEST_CASE(
+    "Coroutine rethrows exceptions, when the result is requested.",
+    "[coroutine]")
+{
+    auto coroutine = [](std::optional<int> const opt) -> gimo::Coroutine<std::optional<int>> {
+        int const value = co_await opt;
+        if (value < 0)
+        {
+            throw std::invalid_argument{"Negative value."};
+        }
+
+        co_return value;
+    };
+
+    gimo::Coroutine<std::optional<int>> throwing = coroutine(-1);
+    CHECK_THROWS_AS(std::move(throwing).result(), std::invalid_argument);
+
+    CHECK(42 == coroutine(42).result());
+}
@@ -0,0 +1,173 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Instrumentation.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include "TestCommons.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace gimo;
+
+namespace
+{
+    using TickingClock = testing::TickingClock<std::nano>;
+}
+
+TEST_CASE(
+    "gimo::CounterSink is an instrumentation_sink.",
+    "[instrumentation]")
+{
+    STATIC_CHECK(instrumentation_sink<CounterSink<>>);
+    STATIC_CHECK(instrumentation_sink<CounterSink<std::chrono::steady_clock>>);
+    STATIC_CHECK(!instrumentation_sink<int>);
+}
+
+TEST_CASE(
+    "gimo::instrumented counts how often each step is entered with a value or a null.",
+    "[instrumentation]")
+{
+    auto const plain = testing::make_observable_pipeline();
+    CounterSink sink{3u};
+    auto const pipeline = gimo::instrumented(plain, sink);
+    STATIC_CHECK(gimo::processable_by<std::optional<int>, decltype(pipeline)>);
+    STATIC_CHECK(std::same_as<decltype(plain.apply(std::optional{1})), decltype(pipeline.apply(std::optional{1}))>);
+
+    CHECK(3 == pipeline.apply(std::optional{2}));
+    CHECK(-1 == pipeline.apply(std::optional{-2}));
+    CHECK(-1 == pipeline.apply(std::optional<int>{}));
+
+    std::vector const statistics = sink.snapshot();
+    REQUIRE(3u == statistics.size());
+    CHECK(StepStatistics{.values = 2u, .nulls = 1u} == statistics[0]);
+    CHECK(StepStatistics{.values = 2u, .nulls = 1u} == statistics[1]);
+    CHECK(StepStatistics{.values = 1u, .nulls = 2u} == statistics[2]);
+    CHECK(3u == statistics[2].invocations());
+}
+
+TEST_CASE(
+    "gimo::instrumented does not fast-forward nulls over the instrumented steps.",
+    "[instrumentation]")
+{
+    using Expected = testing::ExpectedFake<int>;
+
+    auto const plain = gimo::transform([](int const value) { return value + 1; })
+                     | gimo::transform([](int const value) { return std::to_string(value); })
+                     | gimo::transform([](std::string const& str) { return str.size(); });
+    CounterSink sink{3u};
+    auto const pipeline = gimo::instrumented(plain, sink);
+
+    auto const result = pipeline.apply(Expected::from_error("An error."));
+
+    REQUIRE(!result);
+    CHECK_THAT(
+        result.error(),
+        Catch::Matchers::Equals("An error."));
+
+    std::vector const statistics = sink.snapshot();
+    REQUIRE(3u == statistics.size());
+    CHECK(StepStatistics{.nulls = 1u} == statistics[0]);
+    CHECK(StepStatistics{.nulls = 1u} == statistics[1]);
+    CHECK(StepStatistics{.nulls = 1u} == statistics[2]);
+}
+
+TEST_CASE(
+    "gimo::instrumented preserves the exception-guarantees of the pipeline.",
+    "[instrumentation]")
+{
+    CounterSink sink{2u};
+
+    auto const nothrowPlain = gimo::transform([](int const value) noexcept { return value + 1; })
+                            | gimo::transform([](int const value) noexcept { return value * 2; });
+    auto const nothrowPipeline = gimo::instrumented(nothrowPlain, sink);
+    STATIC_CHECK(noexcept(nothrowPlain.apply(std::optional{1})));
+    STATIC_CHECK(noexcept(nothrowPipeline.apply(std::optional{1})));
+
+    auto const throwingPlain = gimo::transform([](int const value) noexcept { return value + 1; })
+                             | gimo::transform([](int const value) { return value * 2; });
+    auto const throwingPipeline = gimo::instrumented(throwingPlain, sink);
+    STATIC_CHECK(!noexcept(throwingPlain.apply(std::optional{1})));
+    STATIC_CHECK(!noexcept(throwingPipeline.apply(std::optional{1})));
+}
+
+TEST_CASE(
+    "gimo::instrumented reports the exclusive duration of each step, when the sink has a clock.",
+    "[instrumentation]")
+{
+    CounterSink<TickingClock> sink{3u};
+    auto const pipeline = gimo::instrumented(testing::make_observable_pipeline(), sink);
+
+    TickingClock::ticks = 0;
+    CHECK(3 == pipeline.apply(std::optional{2}));
+
+    // Each step reads the clock once before and once after its successor: 0(1(2(3 4)5)6)
+    std::vector const statistics = sink.snapshot();
+    REQUIRE(3u == statistics.size());
+    CHECK(std::chrono::nanoseconds{2} == statistics[0].duration);
+    CHECK(std::chrono::nanoseconds{2} == statistics[1].duration);
+    CHECK(std::chrono::nanoseconds{1} == statistics[2].duration);
+}
+
+TEST_CASE(
+    "gimo::instrumented reports the duration of each step, even if a step throws.",
+    "[instrumentation]")
+{
+    CounterSink<TickingClock> sink{2u};
+    auto const pipeline = gimo::instrumented(
+        gimo::transform([](int const value) noexcept { return value + 1; })
+            | gimo::transform([](int const value) -> int { throw value; }),
+        sink);
+
+    TickingClock::ticks = 0;
+    CHECK_THROWS_AS(pipeline.apply(std::optional{1}), int);
+
+    // 0(1(2 3)4)
+    std::vector const statistics = sink.snapshot();
+    REQUIRE(2u == statistics.size());
+    CHECK(std::chrono::nanoseconds{2} == statistics[0].duration);
+    CHECK(std::chrono::nanoseconds{1} == statistics[1].duration);
+}
+
+TEST_CASE(
+    "gimo::CounterSink aggregates the events of all threads.",
+    "[instrumentation]")
+{
+    constexpr std::size_t threadCount{4u};
+    constexpr int iterations{1000};
+    constexpr std::uint64_t invocations{threadCount * iterations};
+
+    CounterSink sink{3u};
+    auto const pipeline = gimo::instrumented(testing::make_observable_pipeline(), sink);
+
+    std::vector<std::thread> threads{};
+    for (std::size_t i{0u}; i < threadCount; ++i)
+    {
+        threads.emplace_back([&] {
+            for (int value{0}; value < iterations; ++value)
+            {
+                [[maybe_unused]] auto const result = pipeline.apply(std::optional{value});
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector const statistics = sink.snapshot();
+    REQUIRE(3u == statistics.size());
+    CHECK(StepStatistics{.values = invocations} == statistics[0]);
+    CHECK(StepStatistics{.values = invocations} == statistics[1]);
+    CHECK(StepStatistics{.values = invocations} == statistics[2]);
+}
@@ -0,0 +1,120 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Lazy.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include "TestCommons.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    [[nodiscard]]
+    auto make_counting_pipeline(int& invocations)
+    {
+        return gimo::transform([&invocations](int const value) {
+            ++invocations;
+            return std::to_string(value);
+        });
+    }
+}
+
+TEST_CASE(
+    "gimo::lazy does not apply the pipeline, until the result is accessed.",
+    "[lazy]")
+{
+    int invocations{};
+    auto lazy = gimo::lazy(std::optional{42}, make_counting_pipeline(invocations));
+    STATIC_CHECK(std::same_as<std::optional<std::string>, typename decltype(lazy)::result_type>);
+
+    CHECK(!lazy.is_evaluated());
+    CHECK(0 == invocations);
+
+    SECTION("When has_value is called.")
+    {
+        CHECK(lazy.has_value());
+    }
+
+    SECTION("When value is called.")
+    {
+        CHECK("42" == lazy.value());
+    }
+
+    SECTION("When result is called.")
+    {
+        CHECK("42" == std::as_const(lazy).result());
+    }
+
+    CHECK(lazy.is_evaluated());
+    CHECK(1 == invocations);
+}
+
+TEST_CASE(
+    "gimo::lazy memoizes the result.",
+    "[lazy]")
+{
+    int invocations{};
+    auto const lazy = gimo::lazy(std::optional{42}, make_counting_pipeline(invocations));
+
+    CHECK(lazy.has_value());
+    CHECK("42" == lazy.value());
+    CHECK("42" == lazy.result());
+    CHECK(1 == invocations);
+}
+
+TEST_CASE(
+    "gimo::lazy propagates the null-state.",
+    "[lazy]")
+{
+    int invocations{};
+    auto const lazy = gimo::lazy(std::optional<int>{}, make_counting_pipeline(invocations));
+
+    CHECK(!lazy.has_value());
+    CHECK(std::nullopt == lazy.result());
+    CHECK(0 == invocations);
+}
+
+TEST_CASE(
+    "gimo::Lazy::apply attaches further steps without forcing the evaluation.",
+    "[lazy]")
+{
+    int invocations{};
+    int suffixInvocations{};
+    auto lazy = gimo::lazy(std::optional{1337}, make_counting_pipeline(invocations))
+                    .apply(gimo::transform([&](std::string const& str) {
+                        ++suffixInvocations;
+                        return str.size();
+                    }));
+    STATIC_CHECK(std::same_as<std::optional<std::size_t>, typename decltype(lazy)::result_type>);
+
+    CHECK(!lazy.is_evaluated());
+    CHECK(0 == invocations);
+    CHECK(0 == suffixInvocations);
+
+    CHECK(4u == lazy.value());
+    CHECK(1 == invocations);
+    CHECK(1 == suffixInvocations);
+}
+
+TEST_CASE(
+    "gimo::Lazy supports move-only types.",
+    "[lazy]")
+{
+    auto lazy = gimo::lazy(
+        std::optional{std::make_unique<int>(42)},
+        gimo::and_then([](std::unique_ptr<int>&& ptr) { return std::optional{std::move(ptr)}; }));
+
+    std::unique_ptr<int> const ptr = std::move(lazy).value();
+
+    REQUIRE(ptr);
+    CHECK(42 == *ptr);
+}
@@ -0,0 +1,78 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/ParallelBatch.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include "TestCommons.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+#ifdef __cpp_lib_execution
+
+namespace
+{
+    constexpr auto pipeline = gimo::transform([](int const value) noexcept { return value * 2; })
+                            | gimo::and_then([](int const value) noexcept -> std::optional<float> {
+                                  if (value < 0)
+                                  {
+                                      return std::nullopt;
+                                  }
+
+                                  return static_cast<float>(value) + 0.5f;
+                              });
+}
+
+TEMPLATE_TEST_CASE(
+    "apply_each supports execution-policies.",
+    "[pipeline]",
+    std::execution::sequenced_policy,
+    std::execution::parallel_policy,
+    std::execution::parallel_unsequenced_policy)
+{
+    std::vector<std::optional<int>> inputs(10'000u);
+    for (std::size_t i{0u}; i < inputs.size(); i += 3u)
+    {
+        inputs[i] = static_cast<int>(i) - 1;
+    }
+
+    std::vector<std::optional<float>> expected{};
+    gimo::apply_each(inputs, pipeline, std::back_inserter(expected));
+
+    std::vector<std::optional<float>> outputs(inputs.size());
+    auto const [in, out] = gimo::apply_each(TestType{}, inputs, pipeline, outputs.begin());
+
+    CHECK(in == inputs.cend());
+    CHECK(out == outputs.cend());
+    CHECK(expected == outputs);
+}
+
+TEST_CASE(
+    "apply_each shares the pipeline between all threads.",
+    "[pipeline]")
+{
+    // Actions are invoked concurrently as const objects, thus any state must be synchronized.
+    std::atomic_size_t invocations{0u};
+    auto const counting = gimo::transform([&](int const value) noexcept {
+        invocations.fetch_add(1u, std::memory_order_relaxed);
+        return value;
+    });
+
+    std::vector<std::optional<int>> const inputs(10'000u, 42);
+    std::vector<std::optional<int>> outputs(inputs.size());
+    gimo::apply_each(std::execution::par, inputs, counting, outputs.begin());
+
+    CHECK(inputs.size() == invocations);
+    CHECK(std::ranges::all_of(outputs, [](auto const& opt) { return opt == 42; }));
+}
+
+#endif
@@ -4,6 +4,19 @@
 //          https://www.boost.org/LICENSE_1_0.txt)
 
 #include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo/algorithm/TransformError.hpp"
+#include "gimo/algorithm/ValueOrElse.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include "TestCommons.hpp"
+
+#include <version>
+
+#ifdef __cpp_lib_expected
+    #include "gimo_ext/StdExpected.hpp"
+#endif
 
 namespace
 {
@@ -11,7 +24,7 @@ namespace
     {
     };
 
-    template <typename T>
+    template <typename T, bool alwaysEngaged = false>
     class NullableMock
     {
     public:
@@ -78,13 +91,73 @@ namespace
     };
 }
 
-template <typename T>
-struct gimo::traits<NullableMock<T>>
+template <typename T, bool alwaysEngaged>
+struct gimo::traits<NullableMock<T, alwaysEngaged>>
 {
     static constexpr NullableNull null{};
+    static constexpr bool always_engaged{alwaysEngaged};
 };
 
+namespace
+{
+    int nullConstructions{0};
+
+    template <typename T>
+    class NullCountingOptional
+    {
+    public:
+        explicit(false) constexpr NullCountingOptional([[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+            ++nullConstructions;
+        }
+
+        explicit constexpr NullCountingOptional(T value)
+            : m_Value{std::move(value)}
+        {
+        }
+
+        NullCountingOptional& operator=([[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+            m_Value.reset();
+            return *this;
+        }
+
+        [[nodiscard]]
+        constexpr T const& operator*() const&
+        {
+            return *m_Value;
+        }
+
+        [[nodiscard]]
+        constexpr T&& operator*() &&
+        {
+            return *std::move(m_Value);
+        }
+
+        [[nodiscard]]
+        friend constexpr bool operator==(NullCountingOptional const& opt, [[maybe_unused]] std::nullopt_t const null) noexcept
+        {
+            return !opt.m_Value;
+        }
+
+    private:
+        std::optional<T> m_Value{};
+    };
+}
+
+template <typename T>
+struct gimo::traits<NullCountingOptional<T>>
+{
+    static constexpr std::nullopt_t null{std::nullopt};
+
+    template <typename V>
+    using rebind_value = NullCountingOptional<V>;
+};
+
+static_assert(gimo::nullable<NullCountingOptional<int>>);
+
 static_assert(gimo::nullable<NullableMock<int>>);
+static_assert(gimo::nullable<NullableMock<int, true>>);
 
 TEST_CASE(
     "Pipelines can be appended.",
@@ -140,3 +213,255 @@ TEST_CASE(
         }
     }
 }
+
+TEST_CASE(
+    "Pipelines skip the emptiness-check of always engaged nullables.",
+    "[pipeline]")
+{
+    mimicpp::Mock<NullableMock<int, true>(float)> action1{};
+    mimicpp::Mock<NullableMock<bool>(int)> action2{};
+
+    NullableMock<float> nullable{};
+    auto pipeline = gimo::and_then(std::ref(action1))
+                  | gimo::and_then(std::ref(action2));
+    STATIC_CHECK(gimo::processable_by<NullableMock<float>, decltype(pipeline)>);
+
+    // There is intentionally no expectation for `NullableMock<int, true>::is_null`, thus any call is reported as violation.
+    mimicpp::ScopedSequence sequence{};
+    sequence += NullableMock<float>::is_null.expect_call()
+            and finally::returns(false);
+    sequence += NullableMock<float>::value.expect_call()
+            and finally::returns(42.f);
+    sequence += action1.expect_call(42.f)
+            and finally::returns_result_of([] { return NullableMock<int, true>{}; });
+    sequence += std::move(NullableMock<int, true>::value).expect_call()
+            and finally::returns(1337);
+    sequence += action2.expect_call(1337)
+            and finally::returns_result_of([] { return NullableMock<bool>{}; });
+
+    decltype(auto) result = pipeline.apply(nullable);
+    STATIC_CHECK(std::same_as<NullableMock<bool>, decltype(result)>);
+}
+
+TEST_CASE(
+    "Pipelines construct the null-state only once, when it is merely propagated.",
+    "[pipeline]")
+{
+    constexpr auto pipeline = gimo::transform([](int const v) { return v + 1; })
+                            | gimo::and_then([](int const v) { return NullCountingOptional{static_cast<float>(v)}; })
+                            | gimo::transform([](float const v) { return std::to_string(v); })
+                            | gimo::transform([](std::string const& str) { return str.size(); });
+
+    NullCountingOptional<int> const input{std::nullopt};
+    nullConstructions = 0;
+
+    decltype(auto) result = pipeline.apply(input);
+    STATIC_CHECK(std::same_as<NullCountingOptional<std::size_t>, decltype(result)>);
+    CHECK(result == std::nullopt);
+    CHECK(1 == nullConstructions);
+}
+
+TEST_CASE(
+    "Null fast-forwarding stops at steps, which handle the null-state on their own.",
+    "[pipeline]")
+{
+    mimicpp::Mock<std::optional<int>()> fallback{};
+    auto const pipeline = gimo::transform([](int const v) { return v + 1; })
+                        | gimo::transform([](int const v) { return v + 1; })
+                        | gimo::or_else(std::ref(fallback))
+                        | gimo::transform([](int const v) { return v * 2; });
+
+    SCOPED_EXP fallback.expect_call()
+        and finally::returns(std::optional{21});
+
+    decltype(auto) result = pipeline.apply(std::optional<int>{});
+    STATIC_CHECK(std::same_as<std::optional<int>, decltype(result)>);
+    CHECK(42 == result);
+}
+
+TEST_CASE(
+    "Null fast-forwarding preserves the error of expected-like inputs.",
+    "[pipeline]")
+{
+    constexpr auto pipeline = gimo::transform([](int const v) { return v + 1; })
+                            | gimo::and_then([](int const v) { return gimo::testing::ExpectedFake<float>{static_cast<float>(v)}; })
+                            | gimo::transform([](float const v) { return static_cast<double>(v); });
+
+    decltype(auto) result = pipeline.apply(gimo::testing::ExpectedFake<int>::from_error("An error."));
+    STATIC_CHECK(std::same_as<gimo::testing::ExpectedFake<double>, decltype(result)>);
+    CHECK(!result);
+    CHECK_THAT(
+        result.error(),
+        Catch::Matchers::Equals("An error."));
+}
+
+TEST_CASE(
+    "Pipelines are noexcept, when every step is nothrow applicable.",
+    "[pipeline]")
+{
+    constexpr auto pipeline = gimo::transform([](int const v) noexcept { return v + 1; })
+                            | gimo::and_then([](int const v) noexcept { return std::optional{static_cast<float>(v)}; })
+                            | gimo::or_else([]() noexcept { return std::optional{-1.f}; })
+                            | gimo::value_or(0.f);
+    using Pipeline = decltype(pipeline);
+
+    STATIC_CHECK(gimo::nothrow_processable_by<std::optional<int>, Pipeline const&>);
+    STATIC_CHECK(gimo::nothrow_processable_by<std::optional<int>&, Pipeline&>);
+    STATIC_CHECK(gimo::nothrow_processable_by<std::optional<int> const&, Pipeline&&>);
+    STATIC_CHECK(noexcept(pipeline.apply(std::optional<int>{})));
+    STATIC_CHECK(noexcept(gimo::apply(std::optional<int>{}, pipeline)));
+
+    STATIC_CHECK(42.f == pipeline.apply(std::optional{41}));
+    STATIC_CHECK(-1.f == pipeline.apply(std::optional<int>{}));
+}
+
+#ifdef __cpp_lib_expected
+
+TEST_CASE(
+    "Pipelines over std::expected are noexcept, when every step is nothrow applicable.",
+    "[pipeline]")
+{
+    using Expected = std::expected<int, int>;
+
+    constexpr auto transforming = gimo::transform([](int const v) noexcept { return v + 1; });
+    constexpr auto chaining = gimo::and_then([](int const v) noexcept { return Expected{v * 2}; });
+    constexpr auto errorTransforming = gimo::transform_error([](int const error) noexcept { return error + 1; });
+    constexpr auto pipeline = transforming | chaining | errorTransforming;
+
+    STATIC_CHECK(gimo::nothrow_processable_by<Expected, decltype(transforming)>);
+    STATIC_CHECK(gimo::nothrow_processable_by<Expected, decltype(chaining)>);
+    STATIC_CHECK(gimo::nothrow_processable_by<Expected, decltype(errorTransforming)>);
+    STATIC_CHECK(gimo::nothrow_processable_by<Expected, decltype(pipeline)>);
+    STATIC_CHECK(gimo::nothrow_processable_by<Expected const&, decltype(pipeline)>);
+    STATIC_CHECK(noexcept(pipeline.apply(Expected{})));
+
+    STATIC_CHECK(Expected{84} == pipeline.apply(Expected{41}));
+    STATIC_CHECK(Expected{std::unexpect, 2} == pipeline.apply(Expected{std::unexpect, 1}));
+}
+
+#endif
+
+TEST_CASE(
+    "Pipelines are potentially throwing, when at least one step is.",
+    "[pipeline]")
+{
+    constexpr auto nothrowStep = gimo::transform([](int const v) noexcept { return v + 1; });
+
+    SECTION("When an action may throw.")
+    {
+        constexpr auto pipeline = nothrowStep
+                                | gimo::transform([](int const v) { return v + 1; })
+                                | nothrowStep;
+
+        STATIC_CHECK(gimo::processable_by<std::optional<int>, decltype(pipeline)>);
+        STATIC_CHECK_FALSE(gimo::nothrow_processable_by<std::optional<int>, decltype(pipeline)>);
+        STATIC_CHECK_FALSE(noexcept(pipeline.apply(std::optional<int>{})));
+    }
+
+    SECTION("When the construction of an intermediate may throw.")
+    {
+        struct ThrowingMove
+        {
+            int value;
+
+            [[nodiscard]]
+            explicit constexpr ThrowingMove(int const v) noexcept
+                : value{v}
+            {
+            }
+
+            // NOLINTNEXTLINE(*-noexcept-move-constructor)
+            constexpr ThrowingMove(ThrowingMove&& other) noexcept(false)
+                : value{other.value}
+            {
+            }
+        };
+
+        constexpr auto pipeline = nothrowStep
+                                | gimo::transform([](int const v) noexcept { return ThrowingMove{v}; })
+                                | gimo::transform([](ThrowingMove const& obj) noexcept { return obj.value; });
+
+        STATIC_CHECK(gimo::processable_by<std::optional<int>, decltype(pipeline)>);
+        STATIC_CHECK_FALSE(gimo::nothrow_processable_by<std::optional<int>, decltype(pipeline)>);
+    }
+
+    SECTION("When the fallback may throw.")
+    {
+        constexpr auto pipeline = nothrowStep
+                                | gimo::value_or_else([] { return 42; });
+
+        STATIC_CHECK(gimo::processable_by<std::optional<int>, decltype(pipeline)>);
+        STATIC_CHECK_FALSE(gimo::nothrow_processable_by<std::optional<int>, decltype(pipeline)>);
+    }
+
+    SECTION("When a null-state is propagated as a potentially throwing error.")
+    {
+        constexpr auto pipeline = gimo::transform([](int const v) noexcept { return v + 1; })
+                                | gimo::transform_error([](std::string const& error) noexcept { return error.size(); });
+
+        STATIC_CHECK(gimo::processable_by<gimo::testing::ExpectedFake<int>, decltype(pipeline)>);
+        STATIC_CHECK_FALSE(gimo::nothrow_processable_by<gimo::testing::ExpectedFake<int>, decltype(pipeline)>);
+    }
+}
+
+TEST_CASE(
+    "gimo::nothrow_applicable_to determines, whether a single step is nothrow applicable.",
+    "[pipeline]")
+{
+    using NothrowAlgorithm = gimo::detail::transform_t<decltype([](int const v) noexcept { return v; })>;
+    using ThrowingAlgorithm = gimo::detail::transform_t<decltype([](int const v) { return v; })>;
+
+    STATIC_CHECK(gimo::nothrow_applicable_to<std::optional<int>, NothrowAlgorithm const&>);
+    STATIC_CHECK(gimo::nothrow_applicable_to<std::optional<int>&&, NothrowAlgorithm&&>);
+    STATIC_CHECK_FALSE(gimo::nothrow_applicable_to<std::optional<int>, ThrowingAlgorithm const&>);
+    STATIC_CHECK_FALSE(gimo::nothrow_applicable_to<std::optional<std::string>, NothrowAlgorithm const&>);
+}
+
+TEST_CASE(
+    "Pipelines do not occupy storage for stateless steps.",
+    "[pipeline]")
+{
+    constexpr auto pipeline = gimo::transform([](int const v) { return v + 1; })
+                            | gimo::and_then([](int const v) { return std::optional{static_cast<float>(v)}; })
+                            | gimo::or_else([] { return std::optional{-1.f}; })
+                            | gimo::transform([](float const v) { return static_cast<double>(v); });
+    using Pipeline = std::remove_cvref_t<decltype(pipeline)>;
+
+    STATIC_CHECK(std::is_empty_v<Pipeline>);
+    STATIC_CHECK(1u == sizeof(Pipeline));
+
+    STATIC_CHECK(std::is_empty_v<std::remove_cvref_t<decltype(pipeline | pipeline)>>);
+    STATIC_CHECK(2.0 == pipeline.apply(std::optional{1}));
+    STATIC_CHECK(-1.0 == pipeline.apply(std::optional<int>{}));
+}
+
+TEST_CASE(
+    "Pipelines pack the state of stateful steps densely.",
+    "[pipeline]")
+{
+    constexpr char small{1};
+    constexpr int medium{2};
+    constexpr double large{3.};
+
+    constexpr auto stateless = gimo::transform([](double const v) { return v; });
+    constexpr auto pipeline = gimo::transform([small](double const v) { return v + small; })
+                            | stateless
+                            | gimo::transform([large](double const v) { return v + large; })
+                            | stateless
+                            | gimo::transform([medium](double const v) { return v + medium; });
+    using Pipeline = std::remove_cvref_t<decltype(pipeline)>;
+
+    // A layout in declaration order would require 24 bytes, due to the padding in front of the `double`.
+    STATIC_CHECK(2u * sizeof(double) == sizeof(Pipeline));
+    STATIC_CHECK(alignof(double) == alignof(Pipeline));
+
+    STATIC_CHECK(7. == pipeline.apply(std::optional{1.}));
+    STATIC_CHECK(std::nullopt == pipeline.apply(std::optional<double>{}));
+
+    SECTION("Which is preserved, when pipelines are appended.")
+    {
+        using Appended = std::remove_cvref_t<decltype(stateless | pipeline | stateless)>;
+
+        STATIC_CHECK(sizeof(Pipeline) == sizeof(Appended));
+    }
+}
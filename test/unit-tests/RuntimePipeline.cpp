@@ -0,0 +1,164 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/RuntimePipeline.hpp"
+#include "gimo/algorithm/AndThen.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include "TestCommons.hpp"
+
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using Step = gimo::ErasedStep<std::optional<int>>;
+    using Runtime = gimo::RuntimePipeline<std::optional<int>>;
+
+    [[nodiscard]]
+    std::vector<Step> make_steps(int& invocations)
+    {
+        std::vector<Step> steps{};
+        steps.emplace_back(gimo::transform([&](int const value) {
+            ++invocations;
+            return value + 1;
+        }));
+        steps.emplace_back(gimo::and_then([&](int const value) -> std::optional<int> {
+            ++invocations;
+            if (value < 0)
+            {
+                return std::nullopt;
+            }
+
+            return value * 2;
+        }));
+        steps.emplace_back(gimo::or_else([&]() -> std::optional<int> {
+            ++invocations;
+            return -1;
+        }));
+        steps.emplace_back(gimo::transform([&](int const value) {
+            ++invocations;
+            return value - 1;
+        }));
+
+        return steps;
+    }
+}
+
+TEST_CASE(
+    "gimo::runtime_step_for determines, whether the pipeline is a homogeneous step.",
+    "[pipeline]")
+{
+    constexpr auto homogeneous = gimo::transform([](int const value) noexcept { return value + 1; });
+    constexpr auto converting = gimo::transform([](int const value) noexcept { return static_cast<float>(value); });
+    constexpr auto roundtrip = converting
+                             | gimo::transform([](float const value) noexcept { return static_cast<int>(value); });
+
+    STATIC_CHECK(gimo::runtime_step_for<decltype(homogeneous), std::optional<int>>);
+    STATIC_CHECK(gimo::runtime_step_for<decltype(roundtrip), std::optional<int>>);
+    STATIC_CHECK_FALSE(gimo::runtime_step_for<decltype(converting), std::optional<int>>);
+    STATIC_CHECK_FALSE(gimo::runtime_step_for<decltype(homogeneous), std::optional<std::string>>);
+    STATIC_CHECK_FALSE(gimo::runtime_step_for<int, std::optional<int>>);
+
+    STATIC_CHECK(std::is_convertible_v<decltype(homogeneous), Step>);
+    STATIC_CHECK_FALSE(std::is_convertible_v<decltype(converting), Step>);
+}
+
+TEST_CASE(
+    "ErasedStep determines, whether the erased pipeline merely propagates the null-state.",
+    "[pipeline]")
+{
+    constexpr auto transformStep = gimo::transform([](int const value) noexcept { return value + 1; });
+    constexpr auto andThenStep = gimo::and_then([](int const value) noexcept { return std::optional{value}; });
+    constexpr auto orElseStep = gimo::or_else([]() noexcept { return std::optional{0}; });
+
+    CHECK(Step{transformStep}.propagates_null());
+    CHECK(Step{andThenStep}.propagates_null());
+    CHECK(Step{transformStep | andThenStep}.propagates_null());
+    CHECK_FALSE(Step{orElseStep}.propagates_null());
+    CHECK_FALSE(Step{transformStep | orElseStep}.propagates_null());
+}
+
+TEST_CASE(
+    "An empty RuntimePipeline returns its input unchanged.",
+    "[pipeline]")
+{
+    Runtime const runtime{};
+
+    CHECK(0u == runtime.size());
+    CHECK(std::optional{42} == runtime.apply(42));
+    CHECK(std::nullopt == runtime.apply(std::nullopt));
+
+    Runtime const compiled{std::vector<Step>{}};
+
+    CHECK(0u == compiled.size());
+    CHECK(std::optional{42} == compiled.apply(42));
+    CHECK(std::nullopt == compiled.apply(std::nullopt));
+}
+
+TEST_CASE(
+    "RuntimePipeline executes the steps in order.",
+    "[pipeline]")
+{
+    int invocations{0};
+    Runtime const runtime{make_steps(invocations)};
+    REQUIRE(4u == runtime.size());
+
+    SECTION("When the input has a value, all value-handling steps are executed.")
+    {
+        CHECK(std::optional{(42 + 1) * 2 - 1} == runtime.apply(42));
+        CHECK(3 == invocations);
+    }
+
+    SECTION("When a step yields null, the following null-propagating steps are skipped.")
+    {
+        CHECK(std::optional{-2} == runtime.apply(-2));
+        CHECK(4 == invocations);
+    }
+
+    SECTION("When the input is null, the leading null-propagating steps are skipped.")
+    {
+        CHECK(std::optional{-2} == runtime.apply(std::nullopt));
+        CHECK(2 == invocations);
+    }
+}
+
+TEST_CASE(
+    "RuntimePipeline yields the same results as the equivalent Pipeline.",
+    "[pipeline]")
+{
+    constexpr auto first = gimo::transform([](int const value) noexcept { return value + 1; });
+    constexpr auto second = gimo::and_then([](int const value) noexcept -> std::optional<int> {
+        if (value % 3 == 0)
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    });
+    constexpr auto third = gimo::or_else([]() noexcept { return std::optional{0}; });
+
+    constexpr auto pipeline = first | second | first | third | second;
+
+    std::vector<Step> steps{};
+    steps.emplace_back(first);
+    steps.emplace_back(second);
+    steps.emplace_back(first);
+    steps.emplace_back(third);
+    steps.emplace_back(second);
+    Runtime const runtime{std::move(steps)};
+
+    for (int i{-5}; i < 5; ++i)
+    {
+        CHECK(pipeline.apply(std::optional{i}) == runtime.apply(i));
+    }
+
+    CHECK(pipeline.apply(std::optional<int>{}) == runtime.apply(std::nullopt));
+}
@@ -0,0 +1,107 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Task.hpp"
+#include "gimo/ThreadPool.hpp"
+
+#include "TestCommons.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    [[nodiscard]]
+    gimo::Task<int> twice(gimo::ThreadPool& pool, int const value)
+    {
+        co_await pool.schedule();
+
+        co_return 2 * value;
+    }
+
+    [[nodiscard]]
+    gimo::Task<std::string> describe(gimo::ThreadPool& pool, int const value)
+    {
+        int const result = co_await twice(pool, value);
+        if (result < 0)
+        {
+            throw std::invalid_argument{"Negative value."};
+        }
+
+        co_return std::to_string(result);
+    }
+}
+
+TEST_CASE(
+    "Task can be created from an already available result.",
+    "[task]")
+{
+    gimo::Task task{42};
+
+    CHECK(task.is_ready());
+    CHECK(42 == gimo::sync_wait(std::move(task)));
+}
+
+TEST_CASE(
+    "Task is lazily started.",
+    "[task]")
+{
+    bool isStarted{false};
+    auto coroutine = [&]() -> gimo::Task<int> {
+        isStarted = true;
+        co_return 42;
+    };
+
+    gimo::Task task = coroutine();
+    CHECK(!task.is_ready());
+    CHECK(!isStarted);
+
+    CHECK(42 == gimo::sync_wait(std::move(task)));
+    CHECK(isStarted);
+}
+
+TEST_CASE(
+    "Task resumes its awaiter, after it has been completed on a ThreadPool.",
+    "[task]")
+{
+    gimo::ThreadPool pool{2u};
+
+    CHECK("84" == gimo::sync_wait(describe(pool, 42)));
+}
+
+TEST_CASE(
+    "gimo::sync_wait rethrows the exception, which escaped the task.",
+    "[task]")
+{
+    gimo::ThreadPool pool{1u};
+
+    CHECK_THROWS_AS(gimo::sync_wait(describe(pool, -1)), std::invalid_argument);
+}
+
+TEST_CASE(
+    "gimo::sync_wait_all runs all tasks concurrently.",
+    "[task]")
+{
+    gimo::ThreadPool pool{4u};
+
+    std::vector<gimo::Task<int>> tasks{};
+    for (int i{0}; i < 100; ++i)
+    {
+        tasks.emplace_back(twice(pool, i));
+    }
+    tasks.emplace_back(gimo::Task{-1});
+
+    std::vector const results = gimo::sync_wait_all(std::move(tasks));
+
+    REQUIRE(101u == results.size());
+    for (int i{0}; i < 100; ++i)
+    {
+        CHECK(2 * i == results[static_cast<std::size_t>(i)]);
+    }
+    CHECK(-1 == results.back());
+}
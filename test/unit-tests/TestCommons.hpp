@@ -5,13 +5,20 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <optional>
 #include <tuple>
 #include <type_traits>
 
 #include <mimic++/mimic++.hpp>
 
 #include "gimo/Common.hpp"
+#include "gimo/algorithm/AndThen.hpp"
 #include "gimo/algorithm/BasicAlgorithm.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
 
 namespace gimo::testing
 {
@@ -207,6 +214,42 @@ namespace gimo::testing
         [[nodiscard]]
         ExpectedFake() = default;
     };
+
+    /**
+     * \brief A clock, which advances by exactly one tick on each query.
+     * \tparam Period The length of a tick.
+     * \details The ticks are counted per thread and may be reset by the tests.
+     */
+    template <typename Period>
+    struct TickingClock
+    {
+        using rep = std::int64_t;
+        using period = Period;
+        using duration = std::chrono::duration<rep, period>;
+        using time_point = std::chrono::time_point<TickingClock>;
+        static constexpr bool is_steady{true};
+
+        static inline thread_local rep ticks{};
+
+        [[nodiscard]]
+        static time_point now() noexcept
+        {
+            return time_point{duration{++ticks}};
+        }
+    };
+
+    /**
+     * \brief Creates a pipeline of three steps, which takes every branch depending on the input.
+     * \details
+     * Increments the value, turns non-positive values into nulls and replaces nulls with `-1`.
+     */
+    [[nodiscard]]
+    inline auto make_observable_pipeline()
+    {
+        return gimo::transform([](int const value) noexcept { return value + 1; })
+             | gimo::and_then([](int const value) { return 0 < value ? std::optional{value} : std::nullopt; })
+             | gimo::or_else([] { return std::optional{-1}; });
+    }
 }
 
 template <typename Value, typename Error>
@@ -0,0 +1,254 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/Tracing.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include "TestCommons.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace gimo;
+
+namespace
+{
+    using TickingClock = testing::TickingClock<std::micro>;
+
+    [[nodiscard]]
+    TraceEvent make_event(std::int64_t const microseconds, std::uint32_t const step, TraceEventKind const kind)
+    {
+        return TraceEvent{
+            .timestamp = std::chrono::microseconds{microseconds},
+            .step = step,
+            .kind = kind};
+    }
+}
+
+TEST_CASE(
+    "gimo::TraceSink is a trace_sink.",
+    "[tracing]")
+{
+    STATIC_CHECK(trace_sink<TraceSink<>>);
+    STATIC_CHECK(trace_sink<ChromeTraceFileSink<>>);
+    STATIC_CHECK(!trace_sink<CounterSink<>>);
+}
+
+TEST_CASE(
+    "gimo::traced records the begin and end of each step, along with the taken branch.",
+    "[tracing]")
+{
+    TickingClock::ticks = 0;
+    TraceSink<TickingClock> sink{};
+    auto const pipeline = gimo::traced(testing::make_observable_pipeline(), sink);
+
+    CHECK(42 == pipeline.apply(std::optional{41}));
+    CHECK(-1 == pipeline.apply(std::optional<int>{}));
+
+    std::vector const traces = sink.collect();
+    REQUIRE(1u == traces.size());
+    CHECK(0u == traces[0].thread);
+    CHECK(0u == traces[0].dropped);
+
+    // The sink queries the clock once on construction.
+    std::vector const expected{
+        make_event(1, 0u, TraceEventKind::enterValue),
+        make_event(2, 1u, TraceEventKind::enterValue),
+        make_event(3, 2u, TraceEventKind::enterValue),
+        make_event(4, 2u, TraceEventKind::exit),
+        make_event(5, 1u, TraceEventKind::exit),
+        make_event(6, 0u, TraceEventKind::exit),
+        make_event(7, 0u, TraceEventKind::enterNull),
+        make_event(8, 1u, TraceEventKind::enterNull),
+        make_event(9, 2u, TraceEventKind::enterNull),
+        make_event(10, 2u, TraceEventKind::exit),
+        make_event(11, 1u, TraceEventKind::exit),
+        make_event(12, 0u, TraceEventKind::exit)};
+    CHECK(expected == traces[0].events);
+}
+
+TEST_CASE(
+    "gimo::traced records the end of each step, even if a step throws.",
+    "[tracing]")
+{
+    TickingClock::ticks = 0;
+    TraceSink<TickingClock> sink{};
+    auto const pipeline = gimo::traced(
+        gimo::transform([](int const value) noexcept { return value + 1; })
+            | gimo::transform([](int const value) -> int { throw value; }),
+        sink);
+
+    CHECK_THROWS_AS(pipeline.apply(std::optional{1}), int);
+
+    std::vector const traces = sink.collect();
+    REQUIRE(1u == traces.size());
+
+    std::vector const expected{
+        make_event(1, 0u, TraceEventKind::enterValue),
+        make_event(2, 1u, TraceEventKind::enterValue),
+        make_event(3, 1u, TraceEventKind::exit),
+        make_event(4, 0u, TraceEventKind::exit)};
+    CHECK(expected == traces[0].events);
+}
+
+TEST_CASE(
+    "gimo::TraceSink overwrites the oldest events, when a buffer is full.",
+    "[tracing]")
+{
+    TickingClock::ticks = 0;
+    TraceSink<TickingClock> sink{4u};
+    auto const pipeline = gimo::traced(testing::make_observable_pipeline(), sink);
+
+    CHECK(42 == pipeline.apply(std::optional{41}));
+
+    std::vector const traces = sink.collect();
+    REQUIRE(1u == traces.size());
+    CHECK(2u == traces[0].dropped);
+
+    std::vector const expected{
+        make_event(3, 2u, TraceEventKind::enterValue),
+        make_event(4, 2u, TraceEventKind::exit),
+        make_event(5, 1u, TraceEventKind::exit),
+        make_event(6, 0u, TraceEventKind::exit)};
+    CHECK(expected == traces[0].events);
+}
+
+TEST_CASE(
+    "gimo::TraceSink records the events of each thread separately.",
+    "[tracing]")
+{
+    TraceSink sink{};
+    auto const pipeline = gimo::traced(testing::make_observable_pipeline(), sink);
+
+    std::vector<std::thread> threads{};
+    for (int i{0}; i < 3; ++i)
+    {
+        threads.emplace_back([&] {
+            for (int value{0}; value < 10; ++value)
+            {
+                [[maybe_unused]] auto const result = pipeline.apply(std::optional{value});
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector const traces = sink.collect();
+    REQUIRE(3u == traces.size());
+    for (std::size_t i{0u}; i < traces.size(); ++i)
+    {
+        CHECK(i == traces[i].thread);
+        CHECK(60u == traces[i].events.size());
+    }
+}
+
+TEST_CASE(
+    "gimo::write_chrome_trace writes the trace-event format.",
+    "[tracing]")
+{
+    std::vector const traces{
+        ThreadTrace{
+            .thread = 0u,
+            .events = {
+                       make_event(1, 0u, TraceEventKind::enterValue),
+                       TraceEvent{.timestamp = std::chrono::nanoseconds{2500}, .step = 1u, .kind = TraceEventKind::enterNull},
+                       make_event(3, 1u, TraceEventKind::exit),
+                       make_event(4, 0u, TraceEventKind::exit)}}
+    };
+    std::vector<std::string> const names{"\"transform\""};
+
+    std::ostringstream out{};
+    gimo::write_chrome_trace(out, traces, names);
+
+    CHECK(
+        out.str()
+        == "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+           "{\"name\":\"Pipeline::apply\",\"cat\":\"gimo\",\"ph\":\"B\",\"ts\":1.000,\"pid\":1,\"tid\":0},\n"
+           "{\"name\":\"\\\"transform\\\"\",\"cat\":\"gimo\",\"ph\":\"B\",\"ts\":1.000,\"pid\":1,\"tid\":0,\"args\":{\"branch\":\"value\"}},\n"
+           "{\"name\":\"step #1\",\"cat\":\"gimo\",\"ph\":\"B\",\"ts\":2.500,\"pid\":1,\"tid\":0,\"args\":{\"branch\":\"null\"}},\n"
+           "{\"name\":\"step #1\",\"cat\":\"gimo\",\"ph\":\"E\",\"ts\":3.000,\"pid\":1,\"tid\":0},\n"
+           "{\"name\":\"\\\"transform\\\"\",\"cat\":\"gimo\",\"ph\":\"E\",\"ts\":4.000,\"pid\":1,\"tid\":0},\n"
+           "{\"name\":\"Pipeline::apply\",\"cat\":\"gimo\",\"ph\":\"E\",\"ts\":4.000,\"pid\":1,\"tid\":0}\n"
+           "]}\n");
+}
+
+TEST_CASE(
+    "gimo::write_chrome_trace skips the leading unmatched events, when events have been dropped.",
+    "[tracing]")
+{
+    std::vector const traces{
+        ThreadTrace{
+            .thread = 0u,
+            .dropped = 2u,
+            .events = {
+                       make_event(3, 1u, TraceEventKind::exit),
+                       make_event(4, 0u, TraceEventKind::exit),
+                       make_event(5, 0u, TraceEventKind::enterNull),
+                       make_event(6, 0u, TraceEventKind::exit)}}
+    };
+
+    std::ostringstream out{};
+    gimo::write_chrome_trace(out, traces);
+
+    CHECK(
+        out.str()
+        == "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+           "{\"name\":\"Pipeline::apply\",\"cat\":\"gimo\",\"ph\":\"B\",\"ts\":5.000,\"pid\":1,\"tid\":0},\n"
+           "{\"name\":\"step #0\",\"cat\":\"gimo\",\"ph\":\"B\",\"ts\":5.000,\"pid\":1,\"tid\":0,\"args\":{\"branch\":\"null\"}},\n"
+           "{\"name\":\"step #0\",\"cat\":\"gimo\",\"ph\":\"E\",\"ts\":6.000,\"pid\":1,\"tid\":0},\n"
+           "{\"name\":\"Pipeline::apply\",\"cat\":\"gimo\",\"ph\":\"E\",\"ts\":6.000,\"pid\":1,\"tid\":0}\n"
+           "]}\n");
+}
+
+TEST_CASE(
+    "gimo::ChromeTraceFileSink writes its traces into a file.",
+    "[tracing]")
+{
+    std::filesystem::path const path = std::filesystem::temp_directory_path() / "gimo-trace-test.json";
+    std::filesystem::remove(path);
+
+    SECTION("When flushed explicitly.")
+    {
+        ChromeTraceFileSink sink{path, {"increment", "validate", "fallback"}};
+        auto const pipeline = gimo::traced(testing::make_observable_pipeline(), sink);
+        CHECK(42 == pipeline.apply(std::optional{41}));
+
+        sink.flush();
+        REQUIRE(std::filesystem::exists(path));
+    }
+
+    SECTION("When destroyed.")
+    {
+        {
+            ChromeTraceFileSink sink{path, {"increment", "validate", "fallback"}};
+            auto const pipeline = gimo::traced(testing::make_observable_pipeline(), sink);
+            CHECK(42 == pipeline.apply(std::optional{41}));
+        }
+
+        REQUIRE(std::filesystem::exists(path));
+    }
+
+    std::ifstream in{path};
+    std::string const content{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+    CHECK(content.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    CHECK(std::string::npos != content.find("\"name\":\"increment\""));
+    CHECK(std::string::npos != content.find("\"name\":\"validate\""));
+    CHECK(std::string::npos != content.find("\"name\":\"fallback\""));
+
+    in.close();
+    std::filesystem::remove(path);
+}
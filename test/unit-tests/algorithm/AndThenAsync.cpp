@@ -0,0 +1,173 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo/ThreadPool.hpp"
+#include "gimo/algorithm/AndThenAsync.hpp"
+#include "gimo/algorithm/OrElse.hpp"
+#include "gimo/algorithm/Transform.hpp"
+#include "gimo_ext/StdOptional.hpp"
+
+#include "TestCommons.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace gimo;
+
+namespace
+{
+    [[nodiscard]]
+    Task<std::optional<std::string>> to_string_async(ThreadPool& pool, int const value)
+    {
+        co_await pool.schedule();
+        if (value < 0)
+        {
+            co_return std::nullopt;
+        }
+
+        co_return std::to_string(value);
+    }
+}
+
+TEST_CASE(
+    "and_then_async algorithm invokes its action only when the input has a value.",
+    "[algorithm]")
+{
+    int invocations{};
+    auto const pipeline = gimo::and_then_async([&](int const value) {
+        ++invocations;
+        return Task{std::optional{value + 1}};
+    });
+    STATIC_CHECK(gimo::processable_by<std::optional<int>, decltype(pipeline)>);
+
+    SECTION("When input has a value, the action is invoked.")
+    {
+        decltype(auto) task = pipeline.apply(std::optional{41});
+        STATIC_CHECK(std::same_as<Task<std::optional<int>>, decltype(task)>);
+
+        CHECK(42 == gimo::sync_wait(std::move(task)));
+        CHECK(1 == invocations);
+    }
+
+    SECTION("When input is null, the null is propagated.")
+    {
+        decltype(auto) task = pipeline.apply(std::optional<int>{});
+        STATIC_CHECK(std::same_as<Task<std::optional<int>>, decltype(task)>);
+
+        CHECK(task.is_ready());
+        CHECK(std::nullopt == gimo::sync_wait(std::move(task)));
+        CHECK(0 == invocations);
+    }
+}
+
+TEST_CASE(
+    "and_then_async algorithm continues with the remaining steps, once the awaitable completes.",
+    "[algorithm]")
+{
+    ThreadPool pool{2u};
+    std::thread::id const callerId = std::this_thread::get_id();
+    std::optional<std::thread::id> continuationId{};
+
+    auto const pipeline = gimo::transform([](int const value) { return value + 1; })
+                        | gimo::and_then_async([&](int const value) { return to_string_async(pool, value); })
+                        | gimo::transform([&](std::string const& str) {
+                              continuationId = std::this_thread::get_id();
+                              return str.size();
+                          });
+    STATIC_CHECK(gimo::processable_by<std::optional<int>, decltype(pipeline)>);
+
+    SECTION("When the awaited nullable has a value.")
+    {
+        decltype(auto) task = pipeline.apply(std::optional{1336});
+        STATIC_CHECK(std::same_as<Task<std::optional<std::size_t>>, decltype(task)>);
+
+        CHECK(4u == gimo::sync_wait(std::move(task)));
+        REQUIRE(continuationId);
+        CHECK(callerId != *continuationId);
+    }
+
+    SECTION("When the awaited nullable is null.")
+    {
+        CHECK(std::nullopt == gimo::sync_wait(pipeline.apply(std::optional{-2})));
+        CHECK(!continuationId);
+    }
+
+    SECTION("When the input is null.")
+    {
+        CHECK(std::nullopt == gimo::sync_wait(pipeline.apply(std::optional<int>{})));
+        CHECK(!continuationId);
+    }
+}
+
+TEST_CASE(
+    "and_then_async algorithm stops the null-propagation at steps, which handle the null-state on their own.",
+    "[algorithm]")
+{
+    ThreadPool pool{1u};
+    auto const pipeline = gimo::and_then_async([&](int const value) { return to_string_async(pool, value); })
+                        | gimo::transform([](std::string const& str) { return str + "!"; })
+                        | gimo::or_else([] { return std::optional<std::string>{"fallback"}; })
+                        | gimo::and_then_async([&](std::string const& str) { return to_string_async(pool, static_cast<int>(str.size())); });
+
+    CHECK("3" == gimo::sync_wait(pipeline.apply(std::optional{42})));
+    CHECK("8" == gimo::sync_wait(pipeline.apply(std::optional{-1})));
+    CHECK("8" == gimo::sync_wait(pipeline.apply(std::optional<int>{})));
+}
+
+TEST_CASE(
+    "and_then_async algorithm supports expected_like types.",
+    "[algorithm]")
+{
+    using Expected = testing::ExpectedFake<int>;
+
+    auto const pipeline = gimo::and_then_async([](int const value) { return Task{Expected{value + 1}}; })
+                        | gimo::transform([](int const value) { return value * 2; });
+
+    SECTION("When input has a value.")
+    {
+        Expected const result = gimo::sync_wait(pipeline.apply(Expected{20}));
+
+        REQUIRE(result);
+        CHECK(42 == *result);
+    }
+
+    SECTION("When input has an error.")
+    {
+        Expected const result = gimo::sync_wait(pipeline.apply(Expected::from_error("An error.")));
+
+        REQUIRE(!result);
+        CHECK_THAT(
+            result.error(),
+            Catch::Matchers::Equals("An error."));
+    }
+}
+
+TEST_CASE(
+    "and_then_async pipelines may be applied concurrently.",
+    "[algorithm]")
+{
+    ThreadPool pool{4u};
+    auto const pipeline = gimo::and_then_async([&](int const value) { return to_string_async(pool, value); })
+                        | gimo::transform([](std::string const& str) { return str.size(); });
+
+    std::vector<Task<std::optional<std::size_t>>> tasks{};
+    for (int i{0}; i < 100; ++i)
+    {
+        // The pipeline is a temporary on purpose, as the task must not depend on its lifetime.
+        auto copy = pipeline;
+        tasks.emplace_back(std::move(copy).apply(std::optional{i}));
+    }
+
+    std::vector const results = gimo::sync_wait_all(std::move(tasks));
+
+    REQUIRE(100u == results.size());
+    CHECK(1u == results[9]);
+    CHECK(2u == results[10]);
+    CHECK(2u == results[99]);
+}
@@ -0,0 +1,183 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo_ext/Arena.hpp"
+#include "gimo.hpp"
+
+#include "../unit-tests/TestCommons.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace
+{
+    struct DestructionCounter
+    {
+        int* destructions;
+
+        ~DestructionCounter() noexcept
+        {
+            ++*destructions;
+        }
+    };
+}
+
+TEMPLATE_TEST_CASE(
+    "gimo::ArenaHandle satisfies the gimo::nullable requirements.",
+    "[ext][arena]",
+    gimo::ArenaHandle<int>,
+    (gimo::ArenaHandle<std::string, gimo::PoolArena>))
+{
+    STATIC_CHECK(gimo::nullable<TestType>);
+    STATIC_CHECK(gimo::nullable<TestType const&>);
+    STATIC_CHECK(gimo::nullable<TestType&&>);
+    STATIC_CHECK(gimo::rebindable_value_to<TestType, float>);
+    STATIC_CHECK(gimo::arena<typename TestType::arena_type>);
+    STATIC_CHECK_FALSE(gimo::expected_like<TestType>);
+}
+
+TEMPLATE_TEST_CASE(
+    "gimo::ArenaHandle keeps whole pipelines inside the arena of the source.",
+    "[ext][arena]",
+    gimo::MonotonicArena,
+    gimo::PoolArena)
+{
+    TestType arena{};
+
+    constexpr auto pipeline = gimo::transform([](int const value) { return std::to_string(value); })
+                            | gimo::and_then([](std::string const& str) {
+                                  return gimo::make_arena_handle<std::size_t>(gimo::current_arena<TestType>(), str.size());
+                              })
+                            | gimo::transform([](std::size_t const size) { return static_cast<int>(size); });
+
+    SECTION("When a value is contained.")
+    {
+        gimo::ArenaScope const scope{arena};
+        auto handle = gimo::make_arena_handle<int>(arena, 1337);
+
+        gimo::ArenaHandle<int, TestType> const result = gimo::apply(std::move(handle), pipeline);
+
+        REQUIRE(result);
+        CHECK(4 == *result);
+        CHECK(&arena == result.arena());
+    }
+
+    SECTION("When null is provided.")
+    {
+        gimo::ArenaHandle<int, TestType> const result = gimo::apply(gimo::ArenaHandle<int, TestType>{}, pipeline);
+
+        CHECK(result == nullptr);
+    }
+
+    SECTION("When or_else creates a new value, the current arena is used.")
+    {
+        gimo::ArenaScope const scope{arena};
+
+        gimo::ArenaHandle<int, TestType> const result = gimo::apply(
+            gimo::ArenaHandle<int, TestType>{},
+            gimo::or_else([] { return gimo::make_arena_handle<int>(gimo::current_arena<TestType>(), 42); }));
+
+        REQUIRE(result);
+        CHECK(42 == *result);
+        CHECK(&arena == result.arena());
+    }
+}
+
+TEST_CASE(
+    "gimo::ArenaHandle destroys its object.",
+    "[ext][arena]")
+{
+    gimo::MonotonicArena arena{};
+    int destructions{0};
+
+    {
+        auto const handle = gimo::make_arena_handle<DestructionCounter>(arena, &destructions);
+        CHECK(0 == destructions);
+    }
+    CHECK(1 == destructions);
+
+    auto handle = gimo::make_arena_handle<DestructionCounter>(arena, &destructions);
+    auto other = std::move(handle);
+    CHECK(handle == nullptr);
+    other.reset();
+    CHECK(2 == destructions);
+    CHECK(other == nullptr);
+}
+
+TEST_CASE(
+    "gimo::MonotonicArena reuses its memory after a reset.",
+    "[ext][arena]")
+{
+    gimo::MonotonicArena arena{256u};
+
+    void* first = arena.allocate(sizeof(int), alignof(int));
+    for (int i{0}; i < 100; ++i)
+    {
+        [[maybe_unused]] void* const memory = arena.allocate(64u, 64u);
+        CHECK(0u == reinterpret_cast<std::uintptr_t>(memory) % 64u);
+    }
+    CHECK(1u < arena.chunk_count());
+
+    arena.reset();
+
+    // The chunks are coalesced, thus the same workload fits into a single chunk.
+    for (int cycle{0}; cycle < 3; ++cycle)
+    {
+        CAPTURE(cycle);
+        void* const next = arena.allocate(sizeof(int), alignof(int));
+        for (int i{0}; i < 100; ++i)
+        {
+            [[maybe_unused]] void* const memory = arena.allocate(64u, 64u);
+        }
+        CHECK(1u == arena.chunk_count());
+
+        if (0 < cycle)
+        {
+            CHECK(first == next);
+        }
+
+        first = next;
+        arena.reset();
+    }
+}
+
+TEST_CASE(
+    "gimo::PoolArena recycles deallocated blocks.",
+    "[ext][arena]")
+{
+    gimo::PoolArena arena{};
+
+    void* const first = arena.allocate(24u, 8u);
+    arena.deallocate(first, 24u, 8u);
+    CHECK(first == arena.allocate(20u, 4u));
+
+    void* const large = arena.allocate(2u * gimo::PoolArena::max_block_size, 8u);
+    CHECK(large != first);
+}
+
+TEST_CASE(
+    "gimo::thread_arena is distinct for each thread.",
+    "[ext][arena]")
+{
+    gimo::MonotonicArena* const mainArena = &gimo::thread_arena<gimo::MonotonicArena>();
+    CHECK(mainArena == &gimo::current_arena<gimo::MonotonicArena>());
+
+    gimo::MonotonicArena* otherArena{};
+    std::thread{[&] { otherArena = &gimo::current_arena<gimo::MonotonicArena>(); }}.join();
+    CHECK(mainArena != otherArena);
+
+    gimo::MonotonicArena scoped{};
+    {
+        gimo::ArenaScope const scope{scoped};
+        CHECK(&scoped == &gimo::current_arena<gimo::MonotonicArena>());
+
+        auto const handle = gimo::traits<gimo::ArenaHandle<int>>::from_value(42);
+        CHECK(&scoped == handle.arena());
+    }
+    CHECK(mainArena == &gimo::current_arena<gimo::MonotonicArena>());
+}
@@ -0,0 +1,146 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo_ext/BitmapColumn.hpp"
+#include "gimo.hpp"
+
+#include "../unit-tests/TestCommons.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace
+{
+    [[nodiscard]]
+    gimo::BitmapColumn<int> make_column(std::size_t const size, std::size_t const validStride)
+    {
+        gimo::BitmapColumn<int> column(size);
+        for (std::size_t i{0u}; i < size; i += validStride)
+        {
+            column.set(i, static_cast<int>(i));
+        }
+
+        return column;
+    }
+}
+
+TEST_CASE(
+    "gimo::BitmapColumn stores the validity of its elements in a bitmap.",
+    "[ext][column]")
+{
+    gimo::BitmapColumn<int> column(130u);
+    CHECK(130u == column.size());
+    CHECK(3u == column.validity().size());
+
+    column.set(0u, 42);
+    column.set(129u, 1337);
+    CHECK(std::optional{42} == column[0u]);
+    CHECK(std::nullopt == column[1u]);
+    CHECK(std::optional{1337} == column[129u]);
+
+    column.reset(0u);
+    CHECK(std::nullopt == column[0u]);
+    CHECK(0u == column.validity()[0u]);
+}
+
+TEST_CASE(
+    "gimo::apply_each applies each element of a column on the pipeline.",
+    "[ext][column]")
+{
+    std::size_t const size = GENERATE(0u, 1u, 63u, 64u, 65u, 200u);
+    std::size_t const validStride = GENERATE(1u, 2u, 3u, 1000u);
+    CAPTURE(size, validStride);
+
+    gimo::BitmapColumn<int> const column = make_column(size, validStride);
+
+    SECTION("When each step propagates the null-state.")
+    {
+        constexpr auto pipeline = gimo::transform([](int const value) { return value * 2; })
+                                | gimo::and_then([](int const value) -> std::optional<float> {
+                                      if (value % 4 == 0)
+                                      {
+                                          return std::nullopt;
+                                      }
+
+                                      return static_cast<float>(value);
+                                  });
+
+        gimo::BitmapColumn<float> const result = gimo::apply_each(column, pipeline);
+
+        REQUIRE(size == result.size());
+        for (std::size_t i{0u}; i < size; ++i)
+        {
+            CAPTURE(i);
+            CHECK(gimo::apply(column[i], pipeline) == result[i]);
+        }
+    }
+
+    SECTION("When the pipeline handles the null-state.")
+    {
+        constexpr auto pipeline = gimo::transform([](int const value) { return value + 1; })
+                                | gimo::value_or(-1);
+
+        gimo::BitmapColumn<int> const result = gimo::apply_each(column, pipeline);
+
+        REQUIRE(size == result.size());
+        for (std::size_t i{0u}; i < size; ++i)
+        {
+            CAPTURE(i);
+            CHECK(std::optional{gimo::apply(column[i], pipeline)} == result[i]);
+        }
+    }
+}
+
+TEST_CASE(
+    "gimo::apply_each ignores validity-bits beyond the column size.",
+    "[ext][column]")
+{
+    std::array const values{1, 2, 3};
+    std::array<std::uint64_t, 1u> const validity{~std::uint64_t{0u}};
+    gimo::BitmapColumnView<int> const column{values, validity};
+
+    gimo::BitmapColumn<int> const result = gimo::apply_each(
+        column,
+        gimo::transform([](int const value) { return value + 1; }));
+
+    REQUIRE(3u == result.size());
+    CHECK(0b111u == result.validity()[0u]);
+    CHECK(std::optional{4} == result[2u]);
+}
+
+TEST_CASE(
+    "gimo::apply_each applies the pipeline on a column as const object.",
+    "[ext][column]")
+{
+    struct Action
+    {
+        [[nodiscard]]
+        int operator()([[maybe_unused]] int const value) const noexcept
+        {
+            return 1;
+        }
+
+        [[nodiscard]]
+        int operator()([[maybe_unused]] int const value) noexcept
+        {
+            return 2;
+        }
+    };
+
+    STATIC_REQUIRE(std::is_trivially_copyable_v<decltype(gimo::transform(Action{}))>);
+
+    gimo::BitmapColumn<int> column(2u);
+    column.set(0u, 42);
+    column.set(1u, 1337);
+
+    gimo::BitmapColumn<int> const result = gimo::apply_each(column, gimo::transform(Action{}));
+
+    REQUIRE(2u == result.size());
+    CHECK(std::optional{1} == result[0u]);
+    CHECK(std::optional{1} == result[1u]);
+}
@@ -0,0 +1,157 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo_ext/CompactExpected.hpp"
+#include "gimo.hpp"
+
+#include "../unit-tests/TestCommons.hpp"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+TEMPLATE_TEST_CASE(
+    "gimo::CompactExpected fits into two machine-words.",
+    "[ext][compact-expected]",
+    (gimo::CompactExpected<int, std::uint16_t>),
+    (gimo::CompactExpected<std::int64_t, std::int32_t>),
+    (gimo::CompactExpected<double, std::uint8_t>),
+    (gimo::CompactExpected<int const*, int>))
+{
+    using Expected = TestType;
+
+    STATIC_CHECK(sizeof(Expected) <= 2u * sizeof(void*));
+    STATIC_CHECK(std::is_trivially_copyable_v<Expected>);
+    STATIC_CHECK(std::is_trivially_destructible_v<Expected>);
+
+    STATIC_CHECK(gimo::expected_like<Expected>);
+    STATIC_CHECK(gimo::expected_like<Expected const&>);
+    STATIC_CHECK(gimo::expected_like<Expected&&>);
+    STATIC_CHECK(gimo::nullable<Expected>);
+}
+
+TEST_CASE(
+    "gimo::CompactExpected with int and std::uint16_t fits into a single machine-word.",
+    "[ext][compact-expected]")
+{
+    STATIC_CHECK(8u == sizeof(gimo::CompactExpected<int, std::uint16_t>));
+}
+
+TEST_CASE(
+    "gimo::compactly_storable rejects large and non-trivial types.",
+    "[ext][compact-expected]")
+{
+    STATIC_CHECK(gimo::compactly_storable<int>);
+    STATIC_CHECK(gimo::compactly_storable<void*>);
+    STATIC_CHECK_FALSE(gimo::compactly_storable<int const>);
+    STATIC_CHECK_FALSE(gimo::compactly_storable<std::string>);
+    STATIC_CHECK_FALSE(gimo::compactly_storable<char[2u * sizeof(void*)]>);
+}
+
+TEST_CASE(
+    "gimo::CompactExpected stores either a value or an error.",
+    "[ext][compact-expected]")
+{
+    using Expected = gimo::CompactExpected<int, std::uint16_t>;
+
+    SECTION("When default constructed, it contains a value-initialized value.")
+    {
+        constexpr Expected exp{};
+
+        STATIC_CHECK(exp.has_value());
+        STATIC_CHECK(0 == *exp);
+    }
+
+    SECTION("When constructed from a value.")
+    {
+        constexpr Expected exp{42};
+
+        STATIC_CHECK(exp.has_value());
+        STATIC_CHECK(42 == *exp);
+        STATIC_CHECK(exp == Expected{42});
+        STATIC_CHECK(exp != Expected{1337});
+        STATIC_CHECK(exp != gimo::traits<Expected>::null);
+    }
+
+    SECTION("When constructed from an error.")
+    {
+        constexpr Expected exp = Expected::from_error(42u);
+
+        STATIC_CHECK_FALSE(exp.has_value());
+        STATIC_CHECK(42u == exp.error());
+        STATIC_CHECK(exp == Expected::from_error(42u));
+        STATIC_CHECK(exp != Expected{42});
+        STATIC_CHECK(exp == gimo::traits<Expected>::null);
+    }
+
+    SECTION("When converted from null, it holds the default error.")
+    {
+        constexpr Expected exp = gimo::traits<Expected>::null;
+
+        STATIC_CHECK(0u == exp.error());
+    }
+}
+
+TEST_CASE(
+    "gimo::CompactExpected rebinds its value- and error-type.",
+    "[ext][compact-expected]")
+{
+    using Expected = gimo::CompactExpected<int, std::uint16_t>;
+
+    STATIC_CHECK(std::same_as<gimo::CompactExpected<float, std::uint16_t>, gimo::rebind_value_t<Expected, float>>);
+    STATIC_CHECK(std::same_as<gimo::CompactExpected<int, std::int64_t>, gimo::rebind_error_t<Expected, std::int64_t>>);
+
+    STATIC_CHECK_FALSE(gimo::rebindable_value_to<Expected, std::string>);
+}
+
+TEST_CASE(
+    "gimo::CompactExpected can be used with the algorithms.",
+    "[ext][compact-expected]")
+{
+    using Expected = gimo::CompactExpected<int, std::uint16_t>;
+
+    constexpr auto pipeline = gimo::and_then([](int const value) -> Expected {
+                                  if (value < 0)
+                                  {
+                                      return Expected::from_error(1u);
+                                  }
+
+                                  return value + 1;
+                              })
+                            | gimo::transform([](int const value) { return static_cast<double>(value) / 2.0; })
+                            | gimo::transform_error([](std::uint16_t const error) { return static_cast<std::int32_t>(error) * -1; });
+
+    using Result = gimo::CompactExpected<double, std::int32_t>;
+
+    SECTION("When a value is contained.")
+    {
+        constexpr Result result = gimo::apply(Expected{41}, pipeline);
+
+        STATIC_CHECK(21.0 == *result);
+    }
+
+    SECTION("When the action returns an error.")
+    {
+        constexpr Result result = gimo::apply(Expected{-1}, pipeline);
+
+        STATIC_CHECK(-1 == result.error());
+    }
+
+    SECTION("When an error is provided.")
+    {
+        constexpr Result result = gimo::apply(Expected::from_error(42u), pipeline);
+
+        STATIC_CHECK(-42 == result.error());
+    }
+
+    SECTION("When or_else recovers from an error.")
+    {
+        constexpr Expected result = gimo::apply(
+            Expected::from_error(42u),
+            gimo::or_else([] { return Expected{1337}; }));
+
+        STATIC_CHECK(1337 == *result);
+    }
+}
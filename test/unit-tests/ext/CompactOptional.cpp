@@ -0,0 +1,144 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo_ext/CompactOptional.hpp"
+#include "gimo.hpp"
+
+#include "../unit-tests/TestCommons.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+
+TEMPLATE_TEST_CASE(
+    "gimo::CompactOptional is as large as its value-type.",
+    "[ext][compact-optional]",
+    std::int32_t,
+    std::uint16_t,
+    double,
+    int const*)
+{
+    using Optional = gimo::CompactOptional<TestType>;
+
+    STATIC_CHECK(sizeof(TestType) == sizeof(Optional));
+    STATIC_CHECK(gimo::nullable<Optional>);
+    STATIC_CHECK(gimo::nullable<Optional const&>);
+    STATIC_CHECK(gimo::nullable<Optional&&>);
+    STATIC_CHECK_FALSE(gimo::expected_like<Optional>);
+
+    STATIC_CHECK(Optional{} == std::nullopt);
+    STATIC_CHECK(Optional{std::nullopt} == std::nullopt);
+    STATIC_CHECK_FALSE(Optional{}.has_value());
+}
+
+TEST_CASE(
+    "gimo::CompactOptional uses the sentinel as null-state.",
+    "[ext][compact-optional]")
+{
+    SECTION("For signed integrals.")
+    {
+        gimo::CompactOptional<int> const opt{42};
+        CHECK(opt.has_value());
+        CHECK(42 == *opt);
+        CHECK(gimo::CompactOptional<int>{} == gimo::CompactOptional<int>{std::nullopt});
+        CHECK(opt != gimo::CompactOptional<int>{});
+    }
+
+    SECTION("For floating-points, any NaN is null.")
+    {
+        gimo::CompactOptional<double> opt{4.2};
+        CHECK(opt.has_value());
+
+        opt.reset();
+        CHECK(opt == std::nullopt);
+        CHECK(opt == gimo::CompactOptional<double>{});
+    }
+
+    SECTION("For custom sentinels.")
+    {
+        using Optional = gimo::CompactOptional<int, gimo::value_sentinel<-1>>;
+
+        Optional const opt{std::numeric_limits<int>::min()};
+        CHECK(opt.has_value());
+        CHECK(Optional{} == std::nullopt);
+    }
+}
+
+TEST_CASE(
+    "gimo::CompactOptional rebinds to a compact optional, when a sentinel-policy exists.",
+    "[ext][compact-optional]")
+{
+    using Custom = gimo::CompactOptional<int, gimo::value_sentinel<-1>>;
+
+    STATIC_CHECK(std::same_as<gimo::CompactOptional<double>, gimo::rebind_value_t<gimo::CompactOptional<int>, double>>);
+    STATIC_CHECK(std::same_as<Custom, gimo::rebind_value_t<Custom, int>>);
+    STATIC_CHECK(std::same_as<gimo::CompactOptional<float>, gimo::rebind_value_t<Custom, float>>);
+    STATIC_CHECK(std::same_as<std::optional<std::string>, gimo::rebind_value_t<gimo::CompactOptional<int>, std::string>>);
+}
+
+TEST_CASE(
+    "gimo::CompactOptional can be used with the algorithms.",
+    "[ext][compact-optional]")
+{
+    constexpr auto pipeline = gimo::transform([](std::int32_t const id) { return static_cast<double>(id) / 2.0; })
+                            | gimo::and_then([](double const value) -> gimo::CompactOptional<double> {
+                                  if (value < 0.0)
+                                  {
+                                      return std::nullopt;
+                                  }
+
+                                  return value;
+                              });
+
+    SECTION("When a value is contained.")
+    {
+        constexpr gimo::CompactOptional<double> result = gimo::apply(gimo::CompactOptional<std::int32_t>{42}, pipeline);
+
+        STATIC_CHECK(21.0 == *result);
+    }
+
+    SECTION("When the action returns null.")
+    {
+        gimo::CompactOptional<double> const result = gimo::apply(gimo::CompactOptional<std::int32_t>{-42}, pipeline);
+
+        CHECK(result == std::nullopt);
+    }
+
+    SECTION("When null is provided.")
+    {
+        gimo::CompactOptional<double> const result = gimo::apply(gimo::CompactOptional<std::int32_t>{}, pipeline);
+
+        CHECK(result == std::nullopt);
+    }
+
+    SECTION("When the value-type lacks a sentinel, std::optional is used.")
+    {
+        std::optional<std::string> const result = gimo::apply(
+            gimo::CompactOptional<std::int32_t>{42},
+            gimo::transform([](std::int32_t const id) { return std::to_string(id); }));
+
+        CHECK(std::optional<std::string>{"42"} == result);
+    }
+
+    SECTION("When value_or terminates the pipeline.")
+    {
+        CHECK(-1.0 == gimo::apply(gimo::CompactOptional<std::int32_t>{}, pipeline | gimo::value_or(-1.0)));
+    }
+}
+
+TEST_CASE(
+    "gimo::transform constructs a new gimo::CompactOptional, even if the value-type is preserved.",
+    "[ext][compact-optional]")
+{
+    // In-place assignments would bypass the sentinel assertion of the constructor.
+    STATIC_CHECK(!gimo::detail::value_owning<gimo::CompactOptional<int>>);
+
+    constexpr auto pipeline = gimo::transform([](int const value) { return value + 1; });
+
+    gimo::CompactOptional<int> const result = gimo::apply(gimo::CompactOptional<int>{41}, pipeline);
+
+    CHECK(42 == *result);
+}
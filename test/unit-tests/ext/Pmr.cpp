@@ -0,0 +1,197 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo_ext/Pmr.hpp"
+#include "gimo_ext/StdSharedPtr.hpp"
+#include "gimo_ext/StdUniquePtr.hpp"
+#include "gimo.hpp"
+
+#include "../unit-tests/TestCommons.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+
+namespace
+{
+    class CountingResource final
+        : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocations{0u};
+
+        [[nodiscard]]
+        explicit CountingResource(std::pmr::memory_resource* const upstream) noexcept
+            : m_Upstream{upstream}
+        {
+        }
+
+    private:
+        std::pmr::memory_resource* m_Upstream;
+
+        void* do_allocate(std::size_t const bytes, std::size_t const alignment) override
+        {
+            ++allocations;
+            return m_Upstream->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* const ptr, std::size_t const bytes, std::size_t const alignment) override
+        {
+            m_Upstream->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]]
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    // Any allocation, which escapes the buffer, either throws or is detected by the address-check.
+    class Arena
+    {
+    public:
+        CountingResource resource{&m_Buffer};
+
+        template <typename T>
+        [[nodiscard]]
+        bool owns(T const* const ptr) const noexcept
+        {
+            auto const* const address = reinterpret_cast<std::byte const*>(ptr);
+            return std::less_equal{}(m_Storage.data(), address)
+                && std::less{}(address, m_Storage.data() + m_Storage.size());
+        }
+
+    private:
+        std::array<std::byte, 1024u> m_Storage{};
+        std::pmr::monotonic_buffer_resource m_Buffer{m_Storage.data(), m_Storage.size(), std::pmr::null_memory_resource()};
+    };
+
+    constexpr auto pipeline = gimo::transform([](int const v) { return v + 1; })
+                            | gimo::transform([](int const v) { return static_cast<float>(v) / 2.f; })
+                            | gimo::transform([](float const v) { return static_cast<double>(v) * 2.0; });
+}
+
+TEST_CASE(
+    "gimo::pmr::unique_ptr does not convert from pointers to derived types.",
+    "[ext][pmr][std::unique_ptr]")
+{
+    struct Base
+    {
+    };
+
+    struct Derived
+        : public Base
+    {
+        int value{};
+    };
+
+    STATIC_CHECK(std::convertible_to<gimo::pmr::unique_ptr<int>, gimo::pmr::unique_ptr<int const>>);
+    STATIC_CHECK(!std::convertible_to<gimo::pmr::Deleter<Derived>, gimo::pmr::Deleter<Base>>);
+    STATIC_CHECK(!std::constructible_from<gimo::pmr::unique_ptr<Base>, gimo::pmr::unique_ptr<Derived>>);
+}
+
+TEST_CASE(
+    "gimo::pmr::unique_ptr propagates its memory-resource through rebinding operations.",
+    "[ext][pmr][std::unique_ptr]")
+{
+    STATIC_CHECK(gimo::nullable<gimo::pmr::unique_ptr<int>>);
+    STATIC_CHECK(std::same_as<gimo::pmr::unique_ptr<float>, gimo::rebind_value_t<gimo::pmr::unique_ptr<int>, float>>);
+    STATIC_CHECK(std::same_as<std::unique_ptr<float>, gimo::rebind_value_t<std::unique_ptr<int>, float>>);
+
+    Arena arena{};
+    gimo::pmr::unique_ptr<int> ptr = gimo::pmr::make_unique<int>(&arena.resource, 41);
+    REQUIRE(1u == arena.resource.allocations);
+
+    SECTION("When transforming an rvalue.")
+    {
+        gimo::pmr::unique_ptr<double> const result = gimo::apply(std::move(ptr), pipeline);
+
+        CHECK(42.0 == *result);
+        CHECK(&arena.resource == result.get_deleter().resource());
+        CHECK(arena.owns(result.get()));
+        // The first step is applied in place.
+        CHECK(3u == arena.resource.allocations);
+    }
+
+    SECTION("When transforming an lvalue.")
+    {
+        gimo::pmr::unique_ptr<double> const result = gimo::apply(ptr, pipeline);
+
+        CHECK(42.0 == *result);
+        CHECK(&arena.resource == result.get_deleter().resource());
+        CHECK(arena.owns(result.get()));
+        CHECK(4u == arena.resource.allocations);
+    }
+
+    SECTION("When the pointer is null.")
+    {
+        gimo::pmr::unique_ptr<double> const result = gimo::apply(gimo::pmr::unique_ptr<int>{}, pipeline);
+
+        CHECK(!result);
+        CHECK(1u == arena.resource.allocations);
+    }
+}
+
+TEST_CASE(
+    "gimo::pmr::shared_ptr propagates its memory-resource through rebinding operations.",
+    "[ext][pmr][std::shared_ptr]")
+{
+    STATIC_CHECK(gimo::nullable<gimo::pmr::shared_ptr<int>>);
+    STATIC_CHECK(std::same_as<gimo::pmr::shared_ptr<float>, gimo::rebind_value_t<gimo::pmr::shared_ptr<int>, float>>);
+
+    Arena arena{};
+    gimo::pmr::shared_ptr<int> ptr = gimo::pmr::make_shared<int>(&arena.resource, 41);
+    REQUIRE(arena.owns(ptr.get()));
+    std::size_t const allocations = arena.resource.allocations;
+
+    SECTION("When a value is contained.")
+    {
+        gimo::pmr::shared_ptr<double> const result = gimo::apply(std::move(ptr), pipeline);
+
+        CHECK(42.0 == *result);
+        CHECK(arena.owns(result.get()));
+        CHECK(&arena.resource == result.resource());
+        // Each step allocates the object along with its control-block at once.
+        CHECK(allocations + 3u == arena.resource.allocations);
+    }
+
+    SECTION("When nullptr is provided.")
+    {
+        gimo::pmr::shared_ptr<double> const result = gimo::apply(gimo::pmr::shared_ptr<int>{}, pipeline);
+
+        CHECK(!result);
+        CHECK(allocations == arena.resource.allocations);
+    }
+}
+
+TEST_CASE(
+    "std::shared_ptr is rebound onto the global heap, even if allocated from a memory-resource.",
+    "[ext][std::shared_ptr]")
+{
+    Arena arena{};
+    std::shared_ptr<int> ptr = std::allocate_shared<int>(std::pmr::polymorphic_allocator<int>{&arena.resource}, 41);
+    REQUIRE(arena.owns(ptr.get()));
+
+    std::shared_ptr const result = gimo::apply(std::move(ptr), pipeline);
+
+    STATIC_CHECK(std::same_as<std::shared_ptr<double> const, decltype(result)>);
+    CHECK(42.0 == *result);
+    CHECK(!arena.owns(result.get()));
+}
+
+TEST_CASE(
+    "gimo::construct_from_value_like falls back to gimo::construct_from_value.",
+    "[ext][pmr]")
+{
+    std::unique_ptr const source = std::make_unique<int>(42);
+
+    std::unique_ptr<float> const result = gimo::construct_from_value_like<float>(source, 1.5f);
+
+    CHECK(1.5f == *result);
+}
@@ -174,3 +174,24 @@ TEMPLATE_LIST_TEST_CASE(
         STATIC_CHECK(1337 == result);
     }
 }
+
+TEST_CASE(
+    "transform algorithm modifies the value of rvalue std::optional in place, when the value-type is preserved.",
+    "[ext][std::optional]")
+{
+    static constexpr gimo::Pipeline pipeline = gimo::transform(
+        [](std::vector<int> v) {
+            v.emplace_back(1337);
+            return v;
+        });
+
+    std::optional opt{std::vector{42}};
+    opt->reserve(8u);
+    int const* const data = opt->data();
+
+    std::optional const result = gimo::apply(std::move(opt), pipeline);
+
+    REQUIRE(result);
+    CHECK(std::vector{42, 1337} == *result);
+    CHECK(data == result->data());
+}
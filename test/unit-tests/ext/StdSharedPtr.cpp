@@ -167,3 +167,45 @@ TEMPLATE_LIST_TEST_CASE(
         CHECK(1337 == result);
     }
 }
+
+TEST_CASE(
+    "transform algorithm never reuses the allocation of std::shared_ptr.",
+    "[ext][std::shared_ptr]")
+{
+    static constexpr gimo::Pipeline pipeline = gimo::transform([](int const v) { return v + 1; })
+                                             | gimo::transform([](int const v) { return v * 2; });
+    STATIC_CHECK(!gimo::detail::value_owning<std::shared_ptr<int>>);
+
+    auto ptr = std::make_shared<int>(42);
+    int const* const address = ptr.get();
+
+    SECTION("When the pointer is the only owner.")
+    {
+        std::shared_ptr const result = gimo::apply(std::move(ptr), pipeline);
+
+        CHECK(86 == *result);
+        CHECK(address != result.get());
+    }
+
+    SECTION("When the value is observed by a std::weak_ptr.")
+    {
+        std::weak_ptr const observer = ptr;
+
+        std::shared_ptr const result = gimo::apply(std::move(ptr), pipeline);
+
+        CHECK(86 == *result);
+        CHECK(address != result.get());
+        CHECK(42 == *observer.lock());
+    }
+
+    SECTION("When the pointer has a non-owning deleter.")
+    {
+        int value{42};
+        std::shared_ptr<int> borrowed{&value, [](int*) noexcept {}};
+
+        std::shared_ptr const result = gimo::apply(std::move(borrowed), pipeline);
+
+        CHECK(86 == *result);
+        CHECK(42 == value);
+    }
+}
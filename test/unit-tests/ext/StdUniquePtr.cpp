@@ -168,3 +168,93 @@ TEMPLATE_LIST_TEST_CASE(
         CHECK(1337 == result);
     }
 }
+
+TEST_CASE(
+    "transform algorithm reuses the allocation of rvalue std::unique_ptr, when the value-type is preserved.",
+    "[ext][std::unique_ptr]")
+{
+    static constexpr gimo::Pipeline pipeline = gimo::transform([](int const v) { return v + 1; })
+                                             | gimo::transform([](int const v) { return v * 2; });
+
+    auto ptr = std::make_unique<int>(42);
+    int const* const address = ptr.get();
+
+    SECTION("When an rvalue is provided, the value is modified in place.")
+    {
+        std::unique_ptr const result = gimo::apply(std::move(ptr), pipeline);
+
+        CHECK(86 == *result);
+        CHECK(address == result.get());
+    }
+
+    SECTION("When an lvalue is provided, a new object is created.")
+    {
+        std::unique_ptr const result = gimo::apply(ptr, pipeline);
+
+        CHECK(86 == *result);
+        CHECK(address != result.get());
+        CHECK(42 == *ptr);
+    }
+
+    SECTION("When the value-type changes, a new object is created.")
+    {
+        std::unique_ptr const result = gimo::apply(
+            std::move(ptr),
+            pipeline | gimo::transform([](int const v) { return static_cast<float>(v); }));
+
+        STATIC_CHECK(std::same_as<std::unique_ptr<float> const, decltype(result)>);
+        CHECK(86.f == *result);
+    }
+}
+
+namespace
+{
+    struct Base
+    {
+        virtual ~Base() = default;
+
+        [[nodiscard]]
+        virtual char const* name() const noexcept
+        {
+            return "Base";
+        }
+
+        int value{};
+    };
+
+    struct Derived final
+        : public Base
+    {
+        [[nodiscard]]
+        char const* name() const noexcept override
+        {
+            return "Derived";
+        }
+    };
+}
+
+TEST_CASE(
+    "transform algorithm does not reuse the allocation of std::unique_ptr to non-final polymorphic types.",
+    "[ext][std::unique_ptr]")
+{
+    STATIC_CHECK(!gimo::detail::value_owning<std::unique_ptr<Base>>);
+    STATIC_CHECK(gimo::detail::value_owning<std::unique_ptr<Derived>>);
+
+    static constexpr gimo::Pipeline pipeline = gimo::transform([](Base const& base) {
+        Base result{};
+        result.value = base.value + 1;
+        return result;
+    });
+
+    std::unique_ptr<Base> ptr = std::make_unique<Derived>();
+    Base const* const address = ptr.get();
+
+    std::unique_ptr const result = gimo::apply(std::move(ptr), pipeline);
+
+    STATIC_CHECK(std::same_as<std::unique_ptr<Base> const, decltype(result)>);
+    CHECK(address != result.get());
+    CHECK(1 == result->value);
+    CHECK_THAT(
+        result->name(),
+        Catch::Matchers::Equals("Base"));
+}
@@ -0,0 +1,199 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo_ext/TaggedPointer.hpp"
+#include "gimo.hpp"
+
+#include "../unit-tests/TestCommons.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace
+{
+    enum class ErrCode : std::int8_t
+    {
+        none = 0,
+        missing = 1,
+        cycle = 2,
+        negative = -3
+    };
+
+    struct Node
+    {
+        int value{};
+        Node* next{};
+    };
+
+    using Result = gimo::TaggedPointer<Node, ErrCode>;
+
+    constexpr auto next_of = [](Node* const node) -> Result {
+        if (!node->next)
+        {
+            return Result::from_error(ErrCode::missing);
+        }
+
+        return node->next;
+    };
+}
+
+TEMPLATE_TEST_CASE(
+    "gimo::TaggedPointer is as large as a pointer.",
+    "[ext][tagged-pointer]",
+    ErrCode,
+    int,
+    std::uint64_t)
+{
+    using Pointer = gimo::TaggedPointer<Node, TestType>;
+
+    STATIC_CHECK(sizeof(Node*) == sizeof(Pointer));
+    STATIC_CHECK(alignof(Node*) == alignof(Pointer));
+    STATIC_CHECK(std::is_trivially_copyable_v<Pointer>);
+
+    STATIC_CHECK(gimo::expected_like<Pointer>);
+    STATIC_CHECK(gimo::expected_like<Pointer const&>);
+    STATIC_CHECK(gimo::expected_like<Pointer&&>);
+    STATIC_CHECK(gimo::nullable<Pointer>);
+}
+
+TEST_CASE(
+    "gimo::TaggedPointer requires suitably aligned pointees and small error-codes.",
+    "[ext][tagged-pointer]")
+{
+    STATIC_CHECK(gimo::taggable<Node>);
+    STATIC_CHECK(gimo::taggable<std::int16_t const>);
+    STATIC_CHECK_FALSE(gimo::taggable<char>);
+    STATIC_CHECK_FALSE(gimo::taggable<void>);
+
+    STATIC_CHECK(gimo::tagged_error<ErrCode>);
+    STATIC_CHECK(gimo::tagged_error<int>);
+    STATIC_CHECK_FALSE(gimo::tagged_error<bool>);
+    STATIC_CHECK_FALSE(gimo::tagged_error<double>);
+}
+
+TEST_CASE(
+    "gimo::TaggedPointer stores either a pointer or an error-code.",
+    "[ext][tagged-pointer]")
+{
+    SECTION("When default constructed, it's a nullptr.")
+    {
+        constexpr Result ptr{};
+
+        STATIC_CHECK(ptr.has_value());
+        CHECK(nullptr == ptr.value());
+    }
+
+    SECTION("When constructed from a pointer.")
+    {
+        Node node{};
+        Result const ptr{&node};
+
+        CHECK(ptr.has_value());
+        CHECK(&node == ptr.value());
+        CHECK(ptr != gimo::traits<Result>::null);
+    }
+
+    SECTION("When constructed from an error.")
+    {
+        ErrCode const error = GENERATE(ErrCode::none, ErrCode::missing, ErrCode::cycle, ErrCode::negative);
+        Result const ptr = Result::from_error(error);
+
+        CHECK_FALSE(ptr.has_value());
+        CHECK(error == ptr.error());
+        CHECK(ptr == gimo::traits<Result>::null);
+    }
+
+    SECTION("When the error-code uses all available bits.")
+    {
+        using Pointer = gimo::TaggedPointer<Node, std::intptr_t>;
+        std::intptr_t const error = GENERATE(
+            std::numeric_limits<std::intptr_t>::min() / 2,
+            std::numeric_limits<std::intptr_t>::max() / 2);
+
+        CHECK(error == Pointer::from_error(error).error());
+    }
+
+    SECTION("When converted from null, it holds the default error.")
+    {
+        Result const ptr = gimo::traits<Result>::null;
+
+        CHECK(ErrCode::none == ptr.error());
+    }
+}
+
+TEST_CASE(
+    "gimo::TaggedPointer rebinds its value- and error-type.",
+    "[ext][tagged-pointer]")
+{
+    STATIC_CHECK(std::same_as<gimo::TaggedPointer<int, ErrCode>, gimo::rebind_value_t<Result, int*>>);
+    STATIC_CHECK(std::same_as<gimo::TaggedPointer<Node const, ErrCode>, gimo::rebind_value_t<Result, Node const*>>);
+    STATIC_CHECK(std::same_as<gimo::TaggedPointer<Node, int>, gimo::rebind_error_t<Result, int>>);
+
+    STATIC_CHECK_FALSE(gimo::rebindable_value_to<Result, int>);
+    STATIC_CHECK_FALSE(gimo::rebindable_value_to<Result, char*>);
+}
+
+TEST_CASE(
+    "gimo::TaggedPointer can be used with the algorithms.",
+    "[ext][tagged-pointer]")
+{
+    Node third{3};
+    Node second{2, &third};
+    Node first{1, &second};
+
+    SECTION("When and_then walks the graph.")
+    {
+        Result const result = gimo::apply(Result{&first}, gimo::and_then(next_of) | gimo::and_then(next_of));
+
+        CHECK(&third == result.value());
+    }
+
+    SECTION("When and_then exceeds the graph.")
+    {
+        Result const result = gimo::apply(
+            Result{&second},
+            gimo::and_then(next_of) | gimo::and_then(next_of) | gimo::and_then(next_of));
+
+        CHECK(ErrCode::missing == result.error());
+    }
+
+    SECTION("When or_else recovers from an error.")
+    {
+        Result const result = gimo::apply(
+            Result::from_error(ErrCode::cycle),
+            gimo::or_else([&]() -> Result { return &first; }));
+
+        CHECK(&first == result.value());
+    }
+
+    SECTION("When transform_error changes the error-type.")
+    {
+        gimo::TaggedPointer<Node, int> const result = gimo::apply(
+            Result{&third},
+            gimo::and_then(next_of)
+                | gimo::transform_error([](ErrCode const error) { return 10 * static_cast<int>(error); }));
+
+        CHECK(10 == result.error());
+    }
+
+    SECTION("When transform_error receives a value, it's forwarded.")
+    {
+        gimo::TaggedPointer<Node, int> const result = gimo::apply(
+            Result{&first},
+            gimo::transform_error([](ErrCode const error) { return static_cast<int>(error); }));
+
+        CHECK(&first == result.value());
+    }
+
+    SECTION("When transform maps to another pointer.")
+    {
+        gimo::TaggedPointer<int, ErrCode> const result = gimo::apply(
+            Result{&first},
+            gimo::transform([](Node* const node) { return &node->value; }));
+
+        CHECK(&first.value == result.value());
+    }
+}
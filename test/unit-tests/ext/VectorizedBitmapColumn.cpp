@@ -0,0 +1,149 @@
+//          Copyright Dominic (DNKpp) Koepke 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gimo_ext/VectorizedBitmapColumn.hpp"
+#include "gimo.hpp"
+
+#include "../unit-tests/TestCommons.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+namespace
+{
+    template <typename T>
+    [[nodiscard]]
+    gimo::BitmapColumn<T> make_column(std::size_t const size, std::size_t const validStride)
+    {
+        gimo::BitmapColumn<T> column(size);
+        for (std::size_t i{0u}; i < size; i += validStride)
+        {
+            column.set(i, static_cast<T>(i));
+        }
+
+        return column;
+    }
+
+    template <typename T, typename Pipeline>
+    void check_equivalence(gimo::BitmapColumn<T> const& column, Pipeline const& pipeline)
+    {
+        auto const expected = gimo::apply_each(column, pipeline);
+        auto const result = gimo::apply_each(gimo::vectorized, column, pipeline);
+        STATIC_CHECK(std::same_as<decltype(expected), decltype(result)>);
+
+        REQUIRE(expected.size() == result.size());
+        for (std::size_t i{0u}; i < result.size(); ++i)
+        {
+            CAPTURE(i);
+            CHECK(expected[i] == result[i]);
+        }
+
+        for (std::size_t word{0u}; word < result.validity().size(); ++word)
+        {
+            CAPTURE(word);
+            CHECK(expected.validity()[word] == result.validity()[word]);
+        }
+    }
+}
+
+TEST_CASE(
+    "Pipelines of transform and value_or steps over trivially copyable values are vectorizable.",
+    "[ext][column]")
+{
+    using gimo::detail::bitmap_column::vectorizable;
+
+    constexpr auto transforming = gimo::transform([](auto const x) { return x + 1; });
+    constexpr auto terminating = transforming | gimo::value_or(42);
+    constexpr auto chaining = transforming | gimo::and_then([](int const x) { return std::optional{x}; });
+    constexpr auto handling = transforming | gimo::value_or_else([] { return 42; });
+
+    STATIC_CHECK(vectorizable<int, decltype(transforming)>);
+    STATIC_CHECK(vectorizable<int, decltype(terminating)>);
+    STATIC_CHECK(!vectorizable<int, decltype(chaining)>);
+    STATIC_CHECK(!vectorizable<int, decltype(handling)>);
+}
+
+TEST_CASE(
+    "Vectorized gimo::apply_each yields the same column as the regular one.",
+    "[ext][column]")
+{
+    std::size_t const size = GENERATE(0u, 1u, 7u, 64u, 65u, 200u);
+    std::size_t const validStride = GENERATE(1u, 2u, 3u, 1000u);
+    CAPTURE(size, validStride);
+
+    SECTION("When the actions accept whole simd-registers.")
+    {
+        auto const column = make_column<float>(size, validStride);
+
+        check_equivalence(column, gimo::transform([](auto const x) { return x * 2.f; }));
+        check_equivalence(
+            column,
+            gimo::transform([](auto const x) { return x * 2.f; })
+                | gimo::transform([](auto const x) { return x - 1.f; })
+                | gimo::value_or(-1.f));
+    }
+
+    SECTION("When the actions accept single values only.")
+    {
+        auto const column = make_column<int>(size, validStride);
+
+        check_equivalence(column, gimo::transform([](int const x) { return x * 2; }));
+        check_equivalence(
+            column,
+            gimo::transform([](int const x) { return static_cast<double>(x) / 2.; })
+                | gimo::value_or(-1.));
+    }
+
+    SECTION("When the pipeline isn't vectorizable.")
+    {
+        auto const column = make_column<int>(size, validStride);
+
+        check_equivalence(
+            column,
+            gimo::transform([](int const x) { return x * 2; })
+                | gimo::and_then([](int const x) -> std::optional<int> {
+                      if (x % 3 == 0)
+                      {
+                          return std::nullopt;
+                      }
+
+                      return x;
+                  }));
+    }
+}
+
+TEST_CASE(
+    "Vectorized gimo::apply_each applies the pipeline as const object.",
+    "[ext][column]")
+{
+    struct Action
+    {
+        [[nodiscard]]
+        int operator()([[maybe_unused]] int const value) const noexcept
+        {
+            return 1;
+        }
+
+        [[nodiscard]]
+        int operator()([[maybe_unused]] int const value) noexcept
+        {
+            return 2;
+        }
+    };
+
+    STATIC_REQUIRE(std::is_trivially_copyable_v<decltype(gimo::transform(Action{}))>);
+
+    gimo::BitmapColumn<int> column(2u);
+    column.set(0u, 42);
+    column.set(1u, 1337);
+
+    gimo::BitmapColumn<int> const result = gimo::apply_each(gimo::vectorized, column, gimo::transform(Action{}));
+
+    REQUIRE(2u == result.size());
+    CHECK(std::optional{1} == result[0u]);
+    CHECK(std::optional{1} == result[1u]);
+}